@@ -0,0 +1,130 @@
+#include "bomb.h"
+#include "bomb_rules.h"
+
+const char *bomb_indicator_labels[] = {
+    "SND", "CLR", "CAR", "IND", "FRQ", "SIG", "NSA", "MSA", "TRN", "BOB", "FRK"
+};
+#define INDICATOR_LABELS (sizeof(bomb_indicator_labels) / sizeof(bomb_indicator_labels[0]))
+
+// Wire counts and Simon length per difficulty (Easy, Medium, Hard)
+static const uint8_t wires_min[3]  = {3, 3, 4};
+static const uint8_t wires_max[3]  = {4, 5, 6};
+static const uint8_t simon_len[3]  = {3, 4, 5};
+
+/* ------------------ PRNG ------------------ */
+// xorshift32, the seed goes through a mixer first so close seeds
+// (consecutive timestamps) still give unrelated bombs
+
+static uint32_t rng_seed(uint32_t seed) {
+    seed ^= seed >> 16; seed *= 0x7feb352d;
+    seed ^= seed >> 15; seed *= 0x846ca68b;
+    seed ^= seed >> 16;
+    return seed ? seed : 0x9e3779b9;
+}
+
+static uint32_t rng_next(uint32_t *rng) {
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *rng = x;
+}
+
+// Uniform 0..n-1 without a division
+static uint32_t rng_below(uint32_t *rng, uint32_t n) {
+    return (uint32_t)(((uint64_t)rng_next(rng) * n) >> 32);
+}
+
+/* ------------------ Generation ------------------ */
+
+static void gen_serial(bomb_t *b, uint32_t *rng) {
+    static const char letters[] = "ABCDEFGHIJKLMNPQRSTUVWXZ"; // no O/Y, like the manual
+    static const char alnum[] = "ABCDEFGHIJKLMNPQRSTUVWXZ0123456789";
+
+    b->serial[0] = alnum[rng_below(rng, sizeof(alnum) - 1)];
+    b->serial[1] = alnum[rng_below(rng, sizeof(alnum) - 1)];
+    b->serial[2] = '0' + rng_below(rng, 10);
+    b->serial[3] = letters[rng_below(rng, sizeof(letters) - 1)];
+    b->serial[4] = letters[rng_below(rng, sizeof(letters) - 1)];
+    b->serial[5] = '0' + rng_below(rng, 10);
+    b->serial[6] = '\0';
+
+    b->serial_odd = (b->serial[5] - '0') & 1;
+    b->serial_vowel = false;
+    for (int i = 0; i < BOMB_SERIAL_LEN; i++) {
+        char c = b->serial[i];
+        if (c == 'A' || c == 'E' || c == 'I' || c == 'U') b->serial_vowel = true;
+    }
+}
+
+static void gen_indicators(bomb_t *b, uint32_t *rng) {
+    uint16_t used = 0;
+    b->batteries = rng_below(rng, 5);
+    b->n_indicators = rng_below(rng, BOMB_INDICATORS + 1);
+    for (int i = 0; i < b->n_indicators; i++) {
+        uint8_t label;
+        do label = rng_below(rng, INDICATOR_LABELS); while (used & (1u << label));
+        used |= 1u << label;
+        b->indicators[i] = (bomb_indicator_t){ .label = label, .lit = rng_next(rng) & 1 };
+    }
+}
+
+static void gen_wires(bomb_t *b, uint32_t *rng) {
+    uint8_t d = b->difficulty;
+    b->n_wires = wires_min[d] + rng_below(rng, wires_max[d] - wires_min[d] + 1);
+
+    uint32_t code = 0, weight = 1;
+    for (int i = 0; i < b->n_wires; i++) {
+        b->wires[i] = rng_below(rng, 5);
+        code += b->wires[i] * weight;
+        weight *= 5;
+    }
+    uint8_t rule = wire_rules[wire_rules_offset[b->n_wires - WIRE_RULES_MIN] + code];
+    b->wire_cut = b->serial_odd ? rule >> 4 : rule & 0x0F;
+}
+
+static void gen_keypad(bomb_t *b, uint32_t *rng) {
+    uint8_t col = rng_below(rng, KEYPAD_COLUMNS);
+    uint8_t picked = 0; // bit per position in the column
+
+    for (int k = 0; k < BOMB_KEYS; k++) {
+        uint8_t pos;
+        do pos = rng_below(rng, KEYPAD_COLUMN_LEN); while (picked & (1u << pos));
+        picked |= 1u << pos;
+        b->keys[k] = keypad_columns[col][pos];
+    }
+
+    // Press order is the order of the symbols in the column
+    int step = 0;
+    for (uint8_t pos = 0; pos < KEYPAD_COLUMN_LEN; pos++) {
+        if (!(picked & (1u << pos))) continue;
+        for (int k = 0; k < BOMB_KEYS; k++) {
+            if (keypad_rank[col][b->keys[k]] == pos) b->key_order[step++] = k;
+        }
+    }
+}
+
+static void gen_simon(bomb_t *b, uint32_t *rng) {
+    b->simon_len = simon_len[b->difficulty];
+    for (int i = 0; i < b->simon_len; i++) b->simon_flash[i] = rng_below(rng, 4);
+
+    const uint8_t (*rules)[4] = simon_rules[b->serial_vowel];
+    for (int s = 0; s < BOMB_MAX_STRIKES; s++) {
+        for (int i = 0; i < b->simon_len; i++) b->simon_press[s][i] = rules[s][b->simon_flash[i]];
+    }
+}
+
+void bomb_generate(bomb_t *b, uint32_t seed, uint8_t difficulty) {
+    *b = (bomb_t){ .seed = seed, .difficulty = difficulty > 2 ? 2 : difficulty };
+    uint32_t rng = rng_seed(seed);
+
+    gen_serial(b, &rng);
+    gen_indicators(b, &rng);
+    gen_wires(b, &rng);
+
+    // Easy: wires, Medium: + keypad, Hard: + Simon
+    b->has_keypad = b->difficulty >= 1;
+    if (b->has_keypad) gen_keypad(b, &rng);
+    b->has_simon = b->difficulty >= 2;
+    if (b->has_simon) gen_simon(b, &rng);
+}
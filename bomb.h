@@ -0,0 +1,64 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ------------------ Bomb ------------------ */
+// Everything about one round is derived from a seed and the difficulty, so a
+// recorded session regenerates the same bomb. Solutions are looked up in the
+// tables from bomb_rules.h at generation time; checking a player action is
+// then a single compare that is cheap enough for the input path.
+
+#define BOMB_SERIAL_LEN  6
+#define BOMB_INDICATORS  3
+#define BOMB_MAX_WIRES   6
+#define BOMB_KEYS        4
+#define BOMB_SIMON_MAX   5
+#define BOMB_MAX_STRIKES 3
+
+typedef enum { WIRE_RED, WIRE_BLUE, WIRE_YELLOW, WIRE_WHITE, WIRE_BLACK } wire_color_t;
+typedef enum { SIMON_RED, SIMON_BLUE, SIMON_GREEN, SIMON_YELLOW } simon_color_t;
+
+typedef struct {
+    uint8_t label; // index into bomb_indicator_labels
+    bool lit;
+} bomb_indicator_t;
+
+typedef struct {
+    uint32_t seed;
+    uint8_t difficulty;      // 0..2, see difficulty_labels
+    char serial[BOMB_SERIAL_LEN + 1];
+    bool serial_odd;         // last digit is odd
+    bool serial_vowel;
+    uint8_t batteries;
+    uint8_t n_indicators;
+    bomb_indicator_t indicators[BOMB_INDICATORS];
+
+    uint8_t n_wires;
+    uint8_t wires[BOMB_MAX_WIRES]; // wire_color_t
+    uint8_t wire_cut;               // the one wire to cut
+
+    bool has_keypad;
+    uint8_t keys[BOMB_KEYS];        // symbol on each key
+    uint8_t key_order[BOMB_KEYS];   // key to press at each step
+
+    bool has_simon;
+    uint8_t simon_len;
+    uint8_t simon_flash[BOMB_SIMON_MAX];                   // simon_color_t
+    uint8_t simon_press[BOMB_MAX_STRIKES][BOMB_SIMON_MAX]; // answer per strike count
+} bomb_t;
+
+extern const char *bomb_indicator_labels[];
+
+void bomb_generate(bomb_t *b, uint32_t seed, uint8_t difficulty);
+
+static inline bool bomb_wire_ok(const bomb_t *b, uint8_t wire) {
+    return wire == b->wire_cut;
+}
+
+static inline bool bomb_key_ok(const bomb_t *b, uint8_t step, uint8_t key) {
+    return step < BOMB_KEYS && b->key_order[step] == key;
+}
+
+static inline bool bomb_simon_ok(const bomb_t *b, uint8_t strikes, uint8_t step, uint8_t color) {
+    return strikes < BOMB_MAX_STRIKES && step < b->simon_len && b->simon_press[strikes][step] == color;
+}
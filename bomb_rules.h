@@ -0,0 +1,1262 @@
+// Generated by tools/gen_bomb_rules.py, do not edit.
+#pragma once
+#include <stdint.h>
+
+#define WIRE_RULES_MIN 3
+#define WIRE_RULES_MAX 6
+
+// Offset of the first 3/4/5/6 wire configuration in wire_rules
+static const uint16_t wire_rules_offset[4] = {0, 125, 750, 3875};
+
+// [offset + colors in base 5, wire 0 least significant] -> wire to cut,
+// low nibble for an even serial number, high nibble for an odd one
+static const uint8_t wire_rules[19500] = {
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11,
+    0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11,
+    0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11,
+    0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22,
+    0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11,
+    0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x31, 0x30, 0x31,
+    0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x33, 0x31, 0x31, 0x31, 0x30, 0x31, 0x31,
+    0x31, 0x31, 0x30, 0x31, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x31, 0x11, 0x11, 0x11, 0x11,
+    0x30, 0x11, 0x00, 0x00, 0x00, 0x30, 0x11, 0x00, 0x00, 0x00, 0x30, 0x11, 0x00, 0x00, 0x00, 0x31,
+    0x30, 0x33, 0x31, 0x31, 0x30, 0x11, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0x33, 0x33, 0x31, 0x00,
+    0x33, 0x11, 0x11, 0x31, 0x00, 0x33, 0x11, 0x11, 0x31, 0x30, 0x31, 0x31, 0x31, 0x30, 0x11, 0x00,
+    0x00, 0x00, 0x31, 0x00, 0x33, 0x11, 0x11, 0x31, 0x00, 0x11, 0x11, 0x11, 0x31, 0x00, 0x11, 0x11,
+    0x11, 0x31, 0x30, 0x31, 0x31, 0x31, 0x30, 0x11, 0x00, 0x00, 0x00, 0x31, 0x00, 0x33, 0x11, 0x11,
+    0x31, 0x00, 0x11, 0x11, 0x11, 0x31, 0x00, 0x11, 0x11, 0x11, 0x20, 0x21, 0x20, 0x20, 0x20, 0x21,
+    0x11, 0x11, 0x11, 0x11, 0x20, 0x11, 0x00, 0x00, 0x00, 0x20, 0x11, 0x00, 0x00, 0x00, 0x20, 0x11,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x33, 0x11, 0x11, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x11,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x21, 0x20, 0x23, 0x21, 0x21, 0x20, 0x11, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x33, 0x33, 0x33, 0x21, 0x00, 0x33, 0x11, 0x11, 0x21, 0x00, 0x33, 0x11, 0x11,
+    0x10, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x33, 0x33, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x33, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x11, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x20, 0x21, 0x21, 0x21, 0x20, 0x11, 0x00, 0x00, 0x00, 0x21, 0x00,
+    0x33, 0x11, 0x11, 0x21, 0x00, 0x11, 0x11, 0x11, 0x21, 0x00, 0x11, 0x11, 0x11, 0x10, 0x11, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x33, 0x00, 0x33, 0x33, 0x33, 0x11, 0x00, 0x33, 0x11, 0x11, 0x11, 0x00, 0x33, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x33, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x11, 0x21, 0x20, 0x21, 0x21, 0x21, 0x20, 0x11, 0x00, 0x00, 0x00, 0x21, 0x00, 0x33, 0x11, 0x11,
+    0x21, 0x00, 0x11, 0x11, 0x11, 0x21, 0x00, 0x11, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33,
+    0x33, 0x33, 0x11, 0x00, 0x33, 0x11, 0x11, 0x11, 0x00, 0x33, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x33, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+    0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25,
+    0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25,
+    0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25,
+    0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25,
+    0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25,
+    0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33,
+    0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25,
+    0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25,
+    0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33,
+    0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25,
+    0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25,
+    0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33,
+    0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25,
+    0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33,
+    0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33,
+    0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25,
+    0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33,
+    0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25,
+    0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25,
+    0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23,
+    0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33,
+    0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33,
+    0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33,
+    0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25,
+    0x33, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25,
+    0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25,
+    0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x33,
+    0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33,
+    0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23,
+    0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55,
+    0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55,
+    0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33,
+    0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23,
+    0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23,
+    0x25, 0x55, 0x25, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x23, 0x33,
+    0x23, 0x23, 0x23, 0x25, 0x33, 0x25, 0x25, 0x33, 0x33, 0x55, 0x33, 0x33, 0x23, 0x25, 0x33, 0x25,
+    0x25, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25,
+    0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23,
+    0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23,
+    0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55,
+    0x25, 0x25, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25,
+    0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0x33, 0x55, 0x55, 0x33, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23,
+    0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55, 0x33, 0x55, 0x23, 0x25, 0x33, 0x25, 0x25, 0x23, 0x25,
+    0x55, 0x25, 0x25, 0x23, 0x23, 0x33, 0x23, 0x23, 0x23, 0x25, 0x55, 0x25, 0x25, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0x23, 0x25, 0x55, 0x25, 0x25, 0x23, 0x25, 0x55, 0x25, 0x25,
+};
+
+#define KEYPAD_COLUMNS 6
+#define KEYPAD_COLUMN_LEN 7
+#define KEYPAD_SYMBOLS 27
+
+static const uint8_t keypad_columns[KEYPAD_COLUMNS][KEYPAD_COLUMN_LEN] = {
+    {0, 1, 2, 3, 4, 5, 6},
+    {7, 0, 6, 8, 9, 5, 10},
+    {11, 12, 8, 13, 14, 2, 9},
+    {15, 16, 17, 4, 13, 10, 18},
+    {19, 18, 17, 20, 16, 21, 22},
+    {15, 7, 23, 24, 19, 25, 26},
+};
+
+// [column][symbol] -> position in the column, 0xff = not in it
+static const uint8_t keypad_rank[KEYPAD_COLUMNS][KEYPAD_SYMBOLS] = {
+    {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x01, 0xff, 0xff, 0xff, 0xff, 0x05, 0x02, 0x00, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x06, 0xff, 0x00, 0x01, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0x04, 0xff, 0x00, 0x01, 0x02, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x02, 0x01, 0x00, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x02, 0x03, 0x05, 0x06},
+};
+
+// [serial has vowel][strikes][flashed color] -> color to press
+static const uint8_t simon_rules[2][3][4] = {
+    {{1, 3, 2, 0}, {0, 1, 3, 2}, {3, 2, 1, 0}},
+    {{1, 0, 3, 2}, {3, 2, 1, 0}, {2, 0, 3, 1}},
+};
@@ -0,0 +1,27 @@
+#include "countdown.h"
+
+void countdownSet(countdown_t *c, unsigned int minutes, unsigned int seconds) {
+    c->seconds = minutes * 60 + seconds;
+    c->lastMinutes = c->seconds / 60;
+}
+
+void countdownStart(countdown_t *c, int64_t now) {
+    c->lastUpdate = now;
+    c->lastMinutes = c->seconds / 60;
+}
+
+int countdownUpdate(countdown_t *c, int64_t now) {
+    int events = 0;
+    if ((now - c->lastUpdate) >= 1000000 && c->seconds > 0) {
+        c->seconds--;
+        c->lastUpdate = now;
+        events |= COUNTDOWN_TICK;
+
+        unsigned int currentMinutes = c->seconds / 60;
+        if (currentMinutes != c->lastMinutes) {
+            c->lastMinutes = currentMinutes;
+            events |= COUNTDOWN_MINUTE;
+        }
+    }
+    return events;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <stdint.h>
+
+// ---------------- Countdown ----------------
+// Bomb timer logic without hardware. timer.c calls countdownUpdate() with
+// esp_timer_get_time(), replay.c with timestamps from a recording.
+
+#define COUNTDOWN_TICK   0x01 // one second went off the clock
+#define COUNTDOWN_MINUTE 0x02 // ... and it was the last second of a minute
+
+typedef struct {
+    unsigned int seconds;      // time left
+    int64_t lastUpdate;        // us of the last tick
+    unsigned int lastMinutes;
+} countdown_t;
+
+void countdownSet(countdown_t *c, unsigned int minutes, unsigned int seconds);
+void countdownStart(countdown_t *c, int64_t now);
+
+// Returns COUNTDOWN_* flags for what happened since the last call
+int countdownUpdate(countdown_t *c, int64_t now);
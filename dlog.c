@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdatomic.h>
+#include "dlog.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "mem.h"
+
+_Static_assert((DLOG_RING_LEN & (DLOG_RING_LEN - 1)) == 0, "DLOG_RING_LEN must be a power of two");
+#define DLOG_MASK (DLOG_RING_LEN - 1)
+#define DLOG_IDLE_MS 20
+
+typedef struct {
+    const char *tag;
+    const char *fmt;
+    uint32_t time_us;  // esp_timer at the call, wraps after 71 minutes
+    uint8_t level;
+    uint8_t nargs;
+    uint32_t args[DLOG_MAX_ARGS];
+} dlog_rec_t;
+
+// Bounded queue with a sequence number per slot: a producer claims a
+// position with one compare-and-swap on dlog_head and publishes the slot
+// by bumping its seq. seq is stored minus the slot index so the all-zero
+// startup state is already valid and nothing needs initializing.
+typedef struct {
+    atomic_uint seq;
+    dlog_rec_t rec;
+} dlog_slot_t;
+
+static dlog_slot_t dlog_ring[DLOG_RING_LEN];
+static atomic_uint dlog_head;
+static unsigned dlog_tail;   // only the dlog task touches it
+static atomic_uint dlog_drops;
+
+FORCE_INLINE_ATTR unsigned slot_seq(dlog_slot_t *s, unsigned pos) {
+    return atomic_load_explicit(&s->seq, memory_order_acquire) + (pos & DLOG_MASK);
+}
+
+FORCE_INLINE_ATTR void slot_set_seq(dlog_slot_t *s, unsigned pos, unsigned seq) {
+    atomic_store_explicit(&s->seq, seq - (pos & DLOG_MASK), memory_order_release);
+}
+
+// In IRAM, so ISRs that run with the flash cache off can log too
+void IRAM_ATTR dlog_write(uint8_t level, const char *tag, const char *fmt, uint8_t nargs, const uint32_t *args) {
+    unsigned pos = atomic_load_explicit(&dlog_head, memory_order_relaxed);
+    dlog_slot_t *slot;
+    for (;;) {
+        slot = &dlog_ring[pos & DLOG_MASK];
+        int diff = (int)(slot_seq(slot, pos) - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&dlog_head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            atomic_fetch_add_explicit(&dlog_drops, 1, memory_order_relaxed); // full
+            return;
+        } else {
+            pos = atomic_load_explicit(&dlog_head, memory_order_relaxed);
+        }
+    }
+
+    dlog_rec_t *r = &slot->rec;
+    r->time_us = (uint32_t)esp_timer_get_time(); // one clock for both cores
+    r->tag = tag;
+    r->fmt = fmt;
+    r->level = level;
+    r->nargs = nargs > DLOG_MAX_ARGS ? DLOG_MAX_ARGS : nargs;
+    for (uint8_t i = 0; i < r->nargs; i++) r->args[i] = args[i];
+    slot_set_seq(slot, pos, pos + 1);
+}
+
+uint32_t dlog_dropped(void) {
+    return atomic_load_explicit(&dlog_drops, memory_order_relaxed);
+}
+
+static void dlog_print(const dlog_rec_t *r) {
+    static const char letters[] = "-EWID";
+    uint32_t a[DLOG_MAX_ARGS] = {0};
+    for (uint8_t i = 0; i < r->nargs; i++) a[i] = r->args[i];
+
+    // Same look as ESP_LOGx, milliseconds since boot
+    printf("%c (%lu) %s: ", letters[r->level <= DLOG_DEBUG ? r->level : 0],
+           (unsigned long)(r->time_us / 1000), r->tag);
+    printf(r->fmt, a[0], a[1], a[2], a[3]);
+    printf("\n");
+}
+
+static void dlog_task(void *arg) {
+    uint32_t reported_drops = 0;
+
+    while (1) {
+        dlog_slot_t *slot = &dlog_ring[dlog_tail & DLOG_MASK];
+        if (slot_seq(slot, dlog_tail) == dlog_tail + 1) {
+            dlog_rec_t rec = slot->rec;
+            slot_set_seq(slot, dlog_tail, dlog_tail + DLOG_RING_LEN);
+            dlog_tail++;
+            dlog_print(&rec);
+            continue;
+        }
+
+        uint32_t drops = dlog_dropped();
+        if (drops != reported_drops) {
+            printf("W dlog: %lu records dropped\n", (unsigned long)(drops - reported_drops));
+            reported_drops = drops;
+        }
+        vTaskDelay(pdMS_TO_TICKS(DLOG_IDLE_MS));
+    }
+}
+
+MEM_TASK_STORAGE(DLOG);
+
+void dlog_start(void) {
+    MEM_TASK_CREATE(DLOG, dlog_task, NULL);
+}
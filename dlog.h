@@ -0,0 +1,58 @@
+#pragma once
+#include <stdint.h>
+#include "mem_config.h"
+
+/* ------------------ Deferred log ------------------ */
+// Drop-in for ESP_LOGx on hot paths. The caller only stores the format
+// pointer and up to DLOG_MAX_ARGS raw 32-bit arguments in a lock-free ring,
+// the "dlog" task formats and prints them later at low priority.
+//
+// Rules: the format and any %s argument must stay valid (string literals,
+// static tables), every argument must fit 32 bits (no %lld, no doubles).
+// If the ring is full the record is dropped and counted.
+// Usable from tasks and ISRs on both cores, dlog_write() is in IRAM so
+// also from ISRs that run while the flash cache is disabled.
+
+#define DLOG_NONE  0
+#define DLOG_ERROR 1
+#define DLOG_WARN  2
+#define DLOG_INFO  3
+#define DLOG_DEBUG 4
+
+// Records above this level are compiled out
+#ifndef DLOG_LEVEL
+#define DLOG_LEVEL DLOG_INFO
+#endif
+
+#define DLOG_MAX_ARGS 4
+
+void dlog_write(uint8_t level, const char *tag, const char *fmt, uint8_t nargs, const uint32_t *args);
+
+// Starts the printing task, records written before are kept
+void dlog_start(void);
+uint32_t dlog_dropped(void);
+
+/* ---- argument packing, 0..DLOG_MAX_ARGS arguments ---- */
+#define DLOG_U32(x) ((uint32_t)(uintptr_t)(x))
+#define DLOG_NARG(...) DLOG_NARG_(0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+#define DLOG_NARG_(_0, _1, _2, _3, _4, n, ...) n
+#define DLOG_CAT(a, b) DLOG_CAT_(a, b)
+#define DLOG_CAT_(a, b) a##b
+#define DLOG_ARGS(...) DLOG_CAT(DLOG_ARGS_, DLOG_NARG(__VA_ARGS__))(__VA_ARGS__)
+#define DLOG_ARGS_0()           0
+#define DLOG_ARGS_1(a)          DLOG_U32(a)
+#define DLOG_ARGS_2(a, b)       DLOG_U32(a), DLOG_U32(b)
+#define DLOG_ARGS_3(a, b, c)    DLOG_U32(a), DLOG_U32(b), DLOG_U32(c)
+#define DLOG_ARGS_4(a, b, c, d) DLOG_U32(a), DLOG_U32(b), DLOG_U32(c), DLOG_U32(d)
+
+#define DLOG_AT(level, tag, fmt, ...) do {                                        \
+        if ((level) <= DLOG_LEVEL) {                                              \
+            const uint32_t dlog_args_[] = { DLOG_ARGS(__VA_ARGS__) };             \
+            dlog_write((level), (tag), (fmt), DLOG_NARG(__VA_ARGS__), dlog_args_); \
+        }                                                                         \
+    } while (0)
+
+#define DLOG_E(tag, fmt, ...) DLOG_AT(DLOG_ERROR, tag, fmt, ##__VA_ARGS__)
+#define DLOG_W(tag, fmt, ...) DLOG_AT(DLOG_WARN,  tag, fmt, ##__VA_ARGS__)
+#define DLOG_I(tag, fmt, ...) DLOG_AT(DLOG_INFO,  tag, fmt, ##__VA_ARGS__)
+#define DLOG_D(tag, fmt, ...) DLOG_AT(DLOG_DEBUG, tag, fmt, ##__VA_ARGS__)
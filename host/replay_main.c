@@ -0,0 +1,111 @@
+// Host side replay of a recording dumped from the device console.
+//   make -C host && ./host/replay [-v] [-n runs] < monitor.log
+// The last REC BEGIN ... REC END block in the input is used.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "recorder.h"
+#include "replay.h"
+
+static uint8_t data[1 << 20];
+static size_t data_len = 0;
+static int64_t base_us = 0;
+static uint32_t dropped = 0;
+static bool verbose = false;
+static char screen[2][17];
+
+static void host_write_line(uint8_t row, const text_line_t *line) {
+    memcpy(screen[row & 1], line->c, TEXT_COLS);
+    if (verbose) printf("  [%u] |%s|\n", row, screen[row & 1]);
+}
+
+static bool read_dump(FILE *in) {
+    char line[512];
+    bool inside = false, found = false;
+    long long base;
+    unsigned long lost;
+
+    while (fgets(line, sizeof(line), in)) {
+        if (sscanf(line, "REC BEGIN base=%lld len=%*u dropped=%lu", &base, &lost) == 2) {
+            inside = true;
+            data_len = 0;
+            base_us = base;
+            dropped = (uint32_t)lost;
+            continue;
+        }
+        if (!inside) continue;
+        if (strncmp(line, "REC END", 7) == 0) {
+            inside = false;
+            found = true;
+            continue;
+        }
+        for (char *p = line; p[0] && p[1] && data_len < sizeof(data); p += 2) {
+            unsigned b;
+            if (sscanf(p, "%2x", &b) != 1) break;
+            data[data_len++] = (uint8_t)b;
+        }
+    }
+    return found;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int runs = 1, opt;
+    while ((opt = getopt(argc, argv, "vn:")) != -1) {
+        if (opt == 'v') verbose = true;
+        else if (opt == 'n') runs = atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-v] [-n runs] < dump\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (!read_dump(stdin)) {
+        fprintf(stderr, "no complete REC BEGIN/REC END block found\n");
+        return 1;
+    }
+
+    if (!replay_can_start(data, data_len, dropped)) {
+        fprintf(stderr, "%u records were dropped and the recording has no checkpoint to start from\n", dropped);
+        return 1;
+    }
+
+    replay_stats_t stats;
+    menu_t menu;
+    countdown_t countdown;
+    double start = now_s();
+    for (int i = 0; i < runs; i++) {
+        menu_init(&menu, host_write_line);
+        countdown = (countdown_t){0};
+        if (!replay_run(data, data_len, base_us, &menu, &countdown, &stats)) {
+            fprintf(stderr, "recording is truncated\n");
+            return 1;
+        }
+        verbose = false; // print the screens of the first run only
+    }
+    double wall = (now_s() - start) / runs;
+
+    double span = (stats.last_us - stats.first_us) / 1e6;
+    printf("records %u (joystick %u, button %u, module %u, ticks %u) over %.3f s\n",
+           stats.records, stats.joystick, stats.buttons, stats.modules, stats.ticks, span);
+    printf("checkpoints %u, %u mismatches, %u records dropped before the first\n",
+           stats.checkpoints, stats.checkpoint_mismatches, dropped);
+    printf("countdown: %u mismatches, max tick drift %lld us, %u s left\n",
+           stats.tick_mismatches, (long long)stats.max_tick_drift_us, countdown.seconds);
+    printf("menu: state %d, cursor %d, difficulty %d, game_time %d\n",
+           menu.state, menu.current_index, menu.difficulty, menu.game_time);
+    if (menu.bomb.serial[0])
+        printf("bomb: serial %s seed %u difficulty %u, cut wire %u of %u\n", menu.bomb.serial,
+               menu.bomb.seed, menu.bomb.difficulty, menu.bomb.wire_cut + 1, menu.bomb.n_wires);
+    printf("screen: |%s|\n        |%s|\n", screen[0], screen[1]);
+    printf("replay %.3f ms per run, %.0fx real time\n", wall * 1e3, wall > 0 ? span / wall : 0);
+    return 0;
+}
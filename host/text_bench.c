@@ -0,0 +1,68 @@
+// Micro-benchmark: LCD line composition with snprintf (the old lcd.c path)
+// against text.c.   make -C host bench && ./host/text_bench
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "text.h"
+
+#define ROUNDS 2000000
+
+static const char *items[] = {"Play", "Difficulty", "Time", "Option 5", "Exit"};
+static volatile char sink;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// What lcd_render_menu() + lcd_write_line() + format_time() used to do
+static void old_path(int i) {
+    char line0[17], line1[17], buf[17], t[16];
+    snprintf(line0, sizeof(line0), "%c%s", (i & 1) ? '>' : ' ', items[i % 5]);
+    snprintf(buf, sizeof(buf), "%-16s", line0);
+    sink = buf[3];
+    snprintf(t, sizeof(t), "%d:%02d", i % 301 / 60, i % 301 % 60);
+    snprintf(line1, sizeof(line1), "%-16s", t);
+    sink = line1[2];
+}
+
+static void new_path(int i) {
+    text_line_t line0, line1;
+    text_clear(&line0);
+    text_put_cursor(&line0, i & 1);
+    text_put_str(&line0, 1, items[i % 5]);
+    sink = line0.c[3];
+    text_clear(&line1);
+    text_put_mss(&line1, 0, i % 301);
+    sink = line1.c[2];
+}
+
+static double bench(void (*fn)(int)) {
+    double start = now_ns();
+    for (int i = 0; i < ROUNDS; i++) fn(i);
+    return (now_ns() - start) / ROUNDS;
+}
+
+int main(void) {
+    // Both paths must print the same thing
+    for (int i = 0; i < 301; i++) {
+        char t[16], want[17];
+        text_line_t line;
+        snprintf(t, sizeof(t), "%d:%02d", i / 60, i % 60);
+        snprintf(want, sizeof(want), "%-16s", t);
+        text_clear(&line);
+        text_put_mss(&line, 0, i);
+        if (memcmp(want, line.c, TEXT_COLS)) {
+            printf("mismatch at %d: |%s| vs |%.16s|\n", i, want, line.c);
+            return 1;
+        }
+    }
+
+    double old_ns = bench(old_path);
+    double new_ns = bench(new_path);
+    printf("menu + time line, snprintf: %6.1f ns\n", old_ns);
+    printf("menu + time line, text.c:   %6.1f ns (%.1fx faster)\n", new_ns, old_ns / new_ns);
+    return 0;
+}
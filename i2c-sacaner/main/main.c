@@ -1,8 +1,12 @@
 #include <driver/i2c.h>
-#include <esp_log.h>
+#include <driver/gpio.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <stdio.h>
+#include "i2c_tune.h"
+#include "mem.h"
+#include "i2c_health.h"
 
 #ifndef APP_CPU_NUM
 #define APP_CPU_NUM PRO_CPU_NUM
@@ -19,49 +23,193 @@
 #define SDA_PIN  5
 #define SCL_PIN  6
 
-static const char *TAG = "i2cscanner";
+#define SCAN_SPEED_HZ 100000
 
-void task(void *ignore)
+// Characterization: every responding device is hammered at each speed from
+// I2C_TUNE_SPEEDS_HZ, the results go to NVS for the game firmware (i2c_tune.h)
+#define CHARACTERIZE_ON_BOOT 1
+#define STRESS_ROUNDS 200 // data writes + 1 byte reads per speed
+#define READ_DETECT_TRIES 3 // at SCAN_SPEED_HZ, write-only devices never ACK a read
+
+// Harmless writes that carry data, so the stress clocks real payload bytes.
+// Other devices get their register pointer set to 0, a no-op for the usual
+// register-pointer chips.
+typedef struct {
+    uint8_t addr;
+    uint8_t len;
+    uint8_t data[2];
+} stress_write_t;
+
+static const stress_write_t stress_writes[] = {
+    {0x3E, 2, {0x00, 0x38}}, // ST7032 LCD: control byte + function set, as sent at init
+};
+
+static void i2c_set_speed(uint32_t hz)
 {
-    i2c_config_t conf;
+    i2c_config_t conf = {0};
     conf.mode = I2C_MODE_MASTER;
     conf.sda_io_num = SDA_PIN;
     conf.scl_io_num = SCL_PIN;
     conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
     conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
-    conf.master.clk_speed = 100000;
+    conf.master.clk_speed = hz;
     i2c_param_config(I2C_NUM_0, &conf);
+}
+
+static esp_err_t i2c_probe(uint8_t addr)
+{
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (addr << 1) | I2C_MASTER_WRITE, 1 /* expect ack */);
+    i2c_master_stop(cmd);
+    esp_err_t res = i2c_master_cmd_begin(I2C_NUM_0, cmd, 10 / portTICK_PERIOD_MS);
+    i2c_cmd_link_delete(cmd);
+    return res;
+}
+
+// The device drives SDA here, which is what breaks first at high clocks
+static esp_err_t i2c_read_probe(uint8_t addr)
+{
+    uint8_t byte;
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (addr << 1) | I2C_MASTER_READ, 1 /* expect ack */);
+    i2c_master_read_byte(cmd, &byte, I2C_MASTER_NACK);
+    i2c_master_stop(cmd);
+    esp_err_t res = i2c_master_cmd_begin(I2C_NUM_0, cmd, 10 / portTICK_PERIOD_MS);
+    i2c_cmd_link_delete(cmd);
+    return res;
+}
+
+// Devices that answered once are tracked in i2c_health, so a flaky cable
+// shows up as NACKs/timeouts in the table printed after every scan. The
+// legacy driver already clocks out and resets a stuck bus on timeout.
+static esp_err_t scan_probe(uint8_t addr)
+{
+    int64_t start = esp_timer_get_time();
+    esp_err_t r = i2c_probe(addr);
+    int64_t end = esp_timer_get_time();
+
+    i2c_health_t *h = r == ESP_OK ? i2c_health_dev(addr) : i2c_health_find(addr);
+    if (h) i2c_health_record(h, i2c_health_classify(r, r != ESP_OK && !gpio_get_level(SDA_PIN)),
+                             (uint32_t)(end - start), end);
+    return r;
+}
+
+static esp_err_t i2c_stress_write(uint8_t addr)
+{
+    static const stress_write_t pointer_write = {0, 1, {0x00}};
+    const stress_write_t *w = &pointer_write;
+    for (size_t i = 0; i < sizeof(stress_writes) / sizeof(stress_writes[0]); i++)
+    {
+        if (stress_writes[i].addr == addr) w = &stress_writes[i];
+    }
+    return i2c_master_write_to_device(I2C_NUM_0, addr, w->data, w->len, 10 / portTICK_PERIOD_MS);
+}
+
+// Asked at the slow scan speed, so a failure means the device does not do
+// reads (the ST7032 LCD is write-only), not that the clock was too fast
+static bool supports_reads(uint8_t addr)
+{
+    i2c_set_speed(SCAN_SPEED_HZ);
+    for (int k = 0; k < READ_DETECT_TRIES; k++)
+    {
+        if (i2c_read_probe(addr) == ESP_OK) return true;
+    }
+    return false;
+}
+
+static void characterize(const uint8_t *found, int n_found)
+{
+    const uint32_t speeds[I2C_TUNE_SPEEDS] = I2C_TUNE_SPEEDS_HZ;
+
+    printf("addr reads  errors per mille at");
+    for (int s = 0; s < I2C_TUNE_SPEEDS; s++) printf(" %4lu k", (unsigned long)(speeds[s] / 1000));
+    printf("  stable up to\n");
+
+    for (int i = 0; i < n_found; i++)
+    {
+        i2c_tune_rec_t rec = {0};
+        bool stable = true;
+        bool reads = supports_reads(found[i]);
+        int transfers = (reads ? 2 : 1) * STRESS_ROUNDS;
+
+        for (int s = 0; s < I2C_TUNE_SPEEDS; s++)
+        {
+            int errors = 0;
+            i2c_set_speed(speeds[s]);
+            for (int k = 0; k < STRESS_ROUNDS; k++)
+            {
+                if (i2c_stress_write(found[i]) != ESP_OK) errors++;
+                if (reads && i2c_read_probe(found[i]) != ESP_OK) errors++;
+            }
+            rec.err_permille[s] = errors * 1000 / transfers;
+
+            // Only count a speed if every slower one was clean too
+            stable = stable && errors == 0;
+            if (stable) rec.max_hz = speeds[s];
+        }
+
+        esp_err_t r = i2c_tune_store(found[i], &rec);
+        printf("0x%02x %-5s                     ", found[i], reads ? "yes" : "no");
+        for (int s = 0; s < I2C_TUNE_SPEEDS; s++) printf(" %6u", rec.err_permille[s]);
+        printf("  %lu Hz%s\n", (unsigned long)rec.max_hz, r == ESP_OK ? "" : " (NVS write failed)");
+    }
+    i2c_set_speed(SCAN_SPEED_HZ);
+}
+
+void task(void *ignore)
+{
+    uint8_t found[0x78];
+    int n_found;
+    bool characterized = !CHARACTERIZE_ON_BOOT;
 
+    ESP_ERROR_CHECK(i2c_tune_init());
+    i2c_set_speed(SCAN_SPEED_HZ);
     i2c_driver_install(I2C_NUM_0, I2C_MODE_MASTER, 0, 0, 0);
 
     while (1)
     {
-        esp_err_t res;
+        // Probe first, print after: formatting inside the loop stretched the scan
+        uint8_t present[0x80 / 8] = {0};
+        n_found = 0;
+        for (uint8_t i = 3; i < 0x78; i++)
+        {
+            if (scan_probe(i) == ESP_OK) {
+                present[i / 8] |= 1 << (i % 8);
+                found[n_found++] = i;
+            }
+        }
+
         printf("     0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f\n");
         printf("00:         ");
         for (uint8_t i = 3; i < 0x78; i++)
         {
-            i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-            i2c_master_start(cmd);
-            i2c_master_write_byte(cmd, (i << 1) | I2C_MASTER_WRITE, 1 /* expect ack */);
-            i2c_master_stop(cmd);
-    
-            res = i2c_master_cmd_begin(I2C_NUM_0, cmd, 10 / portTICK_PERIOD_MS);
             if (i % 16 == 0)
                 printf("\n%.2x:", i);
-            if (res == 0)
+            if (present[i / 8] & (1 << (i % 8)))
                 printf(" %.2x", i);
             else
                 printf(" --");
-            i2c_cmd_link_delete(cmd);
         }
         printf("\n\n");
+        i2c_health_print();
+        printf("\n");
+
+        if (!characterized && n_found)
+        {
+            characterize(found, n_found);
+            characterized = true;
+            mem_report(); // the stress rounds are the deepest this task goes
+        }
         vTaskDelay(pdMS_TO_TICKS(1000));
     }
 }
 
+MEM_TASK_STORAGE(I2C_SCAN);
+
 void app_main()
 {
     // Start task
-    xTaskCreatePinnedToCore(task, TAG, configMINIMAL_STACK_SIZE * 8, NULL, 5, NULL, APP_CPU_NUM);
+    MEM_TASK_CREATE_PINNED(I2C_SCAN, task, NULL, APP_CPU_NUM);
 }
\ No newline at end of file
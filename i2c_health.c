@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include "i2c_health.h"
+
+static i2c_health_t i2c_devs[I2C_HEALTH_MAX_DEVS];
+static uint8_t i2c_dev_count = 0;
+static uint32_t i2c_recoveries = 0;
+static uint32_t i2c_recovery_fails = 0;
+
+i2c_health_t *i2c_health_find(uint8_t addr) {
+    for (uint8_t i = 0; i < i2c_dev_count; i++) {
+        if (i2c_devs[i].addr == addr) return &i2c_devs[i];
+    }
+    return NULL;
+}
+
+i2c_health_t *i2c_health_dev(uint8_t addr) {
+    i2c_health_t *d = i2c_health_find(addr);
+    if (d || i2c_dev_count == I2C_HEALTH_MAX_DEVS) return d;
+    d = &i2c_devs[i2c_dev_count++];
+    d->addr = addr;
+    return d;
+}
+
+i2c_result_t i2c_health_classify(esp_err_t err, bool sda_low) {
+    switch (err) {
+    case ESP_OK:
+        return I2C_RES_OK;
+    case ESP_FAIL:                 // legacy driver: no ACK
+    case ESP_ERR_NOT_FOUND:        // i2c_master_probe(): no ACK
+    case ESP_ERR_INVALID_RESPONSE: // i2c_master transactions: no ACK
+        return I2C_RES_NACK;
+    case ESP_ERR_TIMEOUT:
+        return sda_low ? I2C_RES_ARB_LOST : I2C_RES_TIMEOUT;
+    default:
+        return sda_low ? I2C_RES_ARB_LOST : I2C_RES_OTHER;
+    }
+}
+
+bool i2c_health_allow(i2c_health_t *d) {
+    if (!d->down) return true;
+    d->skipped++;
+    return false;
+}
+
+static uint8_t lat_bucket(uint32_t lat_us) {
+    uint8_t log = 0;
+    while (lat_us >>= 1) log++;
+    if (log < I2C_HEALTH_LAT_MIN_LOG) return 0;
+    log -= I2C_HEALTH_LAT_MIN_LOG - 1;
+    return log < I2C_HEALTH_LAT_BUCKETS ? log : I2C_HEALTH_LAT_BUCKETS - 1;
+}
+
+// Every retry waits twice as long as the one before. The backoff is only
+// reset by normal traffic succeeding, so a device that answers probes but
+// then fails its init does not get re-initialized every 100 ms.
+static void schedule_retry(i2c_health_t *d, int64_t now) {
+    d->retry_at = now + ((int64_t)I2C_HEALTH_RETRY_US << d->backoff);
+    if (d->backoff < I2C_HEALTH_BACKOFF_MAX) d->backoff++;
+}
+
+void i2c_health_mark_down(i2c_health_t *d, int64_t now) {
+    if (!d->down) d->downs++;
+    d->down = true;
+    schedule_retry(d, now);
+}
+
+bool i2c_health_record(i2c_health_t *d, i2c_result_t res, uint32_t lat_us, int64_t now) {
+    d->count[res]++;
+    d->latency[lat_bucket(lat_us)]++;
+
+    if (res == I2C_RES_OK) {
+        if (!d->down) d->backoff = 0;
+        d->down = false;
+        d->fail_streak = 0;
+    } else if (d->down) {
+        schedule_retry(d, now); // failed re-probe
+    } else if (++d->fail_streak >= I2C_HEALTH_FAIL_LIMIT) {
+        i2c_health_mark_down(d, now);
+    }
+    return res == I2C_RES_TIMEOUT || res == I2C_RES_ARB_LOST;
+}
+
+i2c_health_t *i2c_health_probe_due(int64_t now) {
+    for (uint8_t i = 0; i < i2c_dev_count; i++) {
+        if (i2c_devs[i].down && i2c_devs[i].retry_at <= now) return &i2c_devs[i];
+    }
+    return NULL;
+}
+
+void i2c_health_recovered(bool ok) {
+    if (ok) i2c_recoveries++;
+    else i2c_recovery_fails++;
+}
+
+void i2c_health_print(void) {
+    static const char *const lat_labels[I2C_HEALTH_LAT_BUCKETS] = {
+        "<64", "<128", "<256", "<512", "<1k", "<2k", "<4k", "<8k", "<16k", "more",
+    };
+    printf("addr state       ok  nack  tmo  arb other  skip downs | us");
+    for (int b = 0; b < I2C_HEALTH_LAT_BUCKETS; b++) printf(" %4s", lat_labels[b]);
+    printf("\n");
+    for (uint8_t i = 0; i < i2c_dev_count; i++) {
+        const i2c_health_t *d = &i2c_devs[i];
+        printf("0x%02x %-5s %7lu %5lu %4lu %4lu %5lu %5lu %5lu |   ", d->addr, d->down ? "down" : "up",
+               (unsigned long)d->count[I2C_RES_OK], (unsigned long)d->count[I2C_RES_NACK],
+               (unsigned long)d->count[I2C_RES_TIMEOUT], (unsigned long)d->count[I2C_RES_ARB_LOST],
+               (unsigned long)d->count[I2C_RES_OTHER], (unsigned long)d->skipped, (unsigned long)d->downs);
+        for (int b = 0; b < I2C_HEALTH_LAT_BUCKETS; b++) printf(" %4lu", (unsigned long)d->latency[b]);
+        printf("\n");
+    }
+    printf("bus recoveries %lu, failed %lu\n", (unsigned long)i2c_recoveries, (unsigned long)i2c_recovery_fails);
+}
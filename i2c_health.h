@@ -0,0 +1,67 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/* ------------------ I2C bus health ------------------ */
+// Per-device transaction counters and latency histograms, independent of
+// the I2C driver: the caller times the transaction and reports the result.
+// A device that fails I2C_HEALTH_FAIL_LIMIT times in a row is marked down,
+// its transactions fail at once without touching the bus, and it is
+// re-probed with exponential backoff until it answers again.
+// Not locked: one task owns the bus.
+
+#define I2C_HEALTH_MAX_DEVS    8
+#define I2C_HEALTH_FAIL_LIMIT  3
+#define I2C_HEALTH_RETRY_US    100000 // first re-probe after going down
+#define I2C_HEALTH_BACKOFF_MAX 5      // ... doubling up to 3.2 s
+#define I2C_HEALTH_LAT_MIN_LOG 6      // latency buckets: <64 us, <128 us, ...
+#define I2C_HEALTH_LAT_BUCKETS 10     // ... <16 ms, >=16 ms
+
+typedef enum {
+    I2C_RES_OK,
+    I2C_RES_NACK,
+    I2C_RES_TIMEOUT,
+    I2C_RES_ARB_LOST, // SDA held low by someone else
+    I2C_RES_OTHER,
+    I2C_RES_COUNT
+} i2c_result_t;
+
+typedef struct {
+    uint8_t  addr;
+    bool     down;
+    uint8_t  fail_streak;
+    uint8_t  backoff;
+    int64_t  retry_at;                  // next re-probe while down
+    uint32_t count[I2C_RES_COUNT];
+    uint32_t skipped;                   // fast-failed while down
+    uint32_t downs;
+    uint32_t latency[I2C_HEALTH_LAT_BUCKETS];
+} i2c_health_t;
+
+// Finds the device, i2c_health_dev() also adds it (NULL when the table is full)
+i2c_health_t *i2c_health_find(uint8_t addr);
+i2c_health_t *i2c_health_dev(uint8_t addr);
+
+// Maps an error from either I2C driver. Neither reports arbitration loss on
+// its own; with a single master it means a device holds SDA low, so the
+// caller passes the SDA level read after the failure.
+i2c_result_t i2c_health_classify(esp_err_t err, bool sda_low);
+
+// False if the device is down: skip the transaction and fail fast
+bool i2c_health_allow(i2c_health_t *d);
+
+// Counts the result. Returns true if the bus itself looks stuck and should
+// be recovered (timeout or arbitration loss).
+bool i2c_health_record(i2c_health_t *d, i2c_result_t res, uint32_t lat_us, int64_t now);
+
+void i2c_health_mark_down(i2c_health_t *d, int64_t now);
+
+// Next device that is down and due for a re-probe, NULL if none. The caller
+// probes it and reports through i2c_health_record(), success brings it up.
+i2c_health_t *i2c_health_probe_due(int64_t now);
+
+// Bus recoveries (SCL clock-out + controller reset) done by the caller
+void i2c_health_recovered(bool ok);
+
+void i2c_health_print(void);
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include "i2c_tune.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+
+static void i2c_tune_key(uint8_t addr, char key[8]) {
+    snprintf(key, 8, "a%02x", addr);
+}
+
+esp_err_t i2c_tune_init(void) {
+    esp_err_t r = nvs_flash_init();
+    if (r == ESP_ERR_NVS_NO_FREE_PAGES || r == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        r = nvs_flash_erase();
+        if (r == ESP_OK) r = nvs_flash_init();
+    }
+    return r;
+}
+
+esp_err_t i2c_tune_store(uint8_t addr, const i2c_tune_rec_t *rec) {
+    nvs_handle_t nvs;
+    char key[8];
+    esp_err_t r = nvs_open(I2C_TUNE_NAMESPACE, NVS_READWRITE, &nvs);
+    if (r != ESP_OK) return r;
+
+    i2c_tune_key(addr, key);
+    r = nvs_set_blob(nvs, key, rec, sizeof(*rec));
+    if (r == ESP_OK) r = nvs_commit(nvs);
+    nvs_close(nvs);
+    return r;
+}
+
+esp_err_t i2c_tune_load(uint8_t addr, i2c_tune_rec_t *rec) {
+    nvs_handle_t nvs;
+    char key[8];
+    size_t len = sizeof(*rec);
+    esp_err_t r = nvs_open(I2C_TUNE_NAMESPACE, NVS_READONLY, &nvs);
+    if (r != ESP_OK) return r;
+
+    i2c_tune_key(addr, key);
+    r = nvs_get_blob(nvs, key, rec, &len);
+    nvs_close(nvs);
+    if (r == ESP_OK && len != sizeof(*rec)) r = ESP_ERR_INVALID_SIZE;
+    return r;
+}
+
+uint32_t i2c_tune_speed(uint8_t addr, uint32_t fallback_hz) {
+    i2c_tune_rec_t rec;
+    if (i2c_tune_load(addr, &rec) != ESP_OK || rec.max_hz == 0) return fallback_hz;
+    return rec.max_hz / 100 * I2C_TUNE_MARGIN_PCT;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+#include "esp_err.h"
+
+/* ------------------ I2C tuning ------------------ */
+// The i2c scanner firmware measures how fast every device on the bus can be
+// clocked and stores the result in NVS. Other firmware on the same board
+// reads it back when adding devices.
+
+#define I2C_TUNE_NAMESPACE  "i2c_tune"
+#define I2C_TUNE_SPEEDS     3
+#define I2C_TUNE_SPEEDS_HZ  {100000, 400000, 1000000}
+#define I2C_TUNE_MARGIN_PCT 75 // run devices at 3/4 of their highest stable speed
+
+typedef struct {
+    uint32_t max_hz;                       // highest speed with no errors, 0 = none
+    uint16_t err_permille[I2C_TUNE_SPEEDS]; // error rate measured at each speed
+} i2c_tune_rec_t;
+
+// nvs_flash_init() with the usual erase-and-retry on a full/old partition
+esp_err_t i2c_tune_init(void);
+
+esp_err_t i2c_tune_store(uint8_t addr, const i2c_tune_rec_t *rec);
+esp_err_t i2c_tune_load(uint8_t addr, i2c_tune_rec_t *rec);
+
+// Speed to add the device with: tuned speed minus the margin,
+// or fallback_hz if the device was never characterized
+uint32_t i2c_tune_speed(uint8_t addr, uint32_t fallback_hz);
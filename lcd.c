@@ -1,11 +1,28 @@
 #include <stdio.h>
+#include <sys/param.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "driver/i2c_master.h"
 #include "esp_err.h"
-#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_rom_sys.h"
+#include "esp_rom_gpio.h"
+#include "soc/gpio_sig_map.h"
+#include "soc/i2c_periph.h"
 #include "driver/adc.h"
 #include "driver/gpio.h"
+#include "menu.h"
+#include "recorder.h"
+#include "replay.h"
+#include "scanner.h"
+#include "i2c_tune.h"
+#include "dlog.h"
+#include "text.h"
+#include "mem.h"
+#include "i2c_health.h"
 
 
 /* ------------------ CONFIG ------------------ */
@@ -15,8 +32,20 @@
 
 #define ADC_WIDTH ADC_WIDTH_BIT_12
 #define ADC_ATTEN ADC_ATTEN_DB_11
-#define DEADZONE  300
-#define SCROLL    2000
+#define DEADZONE  300   // center drift is only tracked inside this band
+#define SCROLL    1200  // deflection from center that starts a scroll
+#define SCROLL_RELEASE 800 // ... and that ends it (hysteresis)
+
+// Stick conditioning, see joystick_sample()
+#define JOY_SAMPLE_US        1000 // ADC read at 1 kHz
+#define JOY_OVERSAMPLE_SHIFT 2    // 4 reads are summed into one filter step (4 ms)
+#define JOY_FRAC_BITS        4    // filter state is fixed point Q.4
+#define JOY_IIR_SHIFT        2    // y += (x - y) / 4, ~16 ms time constant
+#define JOY_CAL_STEPS        16   // boot center = average of the first 64 ms
+#define JOY_DRIFT_SHIFT      10   // resting center follows drift over ~4 s
+#define JOY_REPEAT_DELAY_MS  400  // hold this long before auto-repeat starts
+#define JOY_REPEAT_START_MS  160  // first repeat interval
+#define JOY_REPEAT_MIN_MS    60   // repeats speed up by 1/4 each until this (~menu loop)
 
 
 #define I2C_BUS_PORT 0
@@ -24,111 +53,150 @@
 #define PIN_NUM_SCL 14 // On ESP32-S3 board 13
 #define LCD_ADDRESS 0x3E
 #define RGB_ADDRESS 0x60
-#define I2C_MASTER_FREQ_HZ (50 * 1000)
+#define I2C_MASTER_FREQ_HZ (50 * 1000) // until the i2c scanner has characterized a device
+#define I2C_XFER_TIMEOUT_MS 10 // one tick at 100 Hz; a 17 byte line at 50 kHz takes 3.4 ms
+#define I2C_CLEAR_HALF_US   5  // SCL half period while clocking out a stuck device
 
+// ST7032 timings from the datasheet (plus some margin)
+#define LCD_POWER_ON_US  50000   // >40 ms after VDD before first command
+#define LCD_CMD_US       30      // most instructions take 26.3 us
+#define LCD_CLEAR_US     2000    // clear / return home take 1.08 ms
+#define LCD_MAX_SCL_HZ   300000  // 400 kHz max, and in a burst every data byte
+                                 // must take longer than the 26.3 us write time
+#define LCD_FOLLOWER_US  200000  // follower circuit needs 200 ms to settle
+#define INIT_SPIN_US     100     // init waits up to this are spun, longer ones deferred
+#define RGB_OSC_US       500     // PCA9633: oscillator runs 500 us after MODE1 clears SLEEP
 
-static const char *TAG = "MAIN";
-
-/* ------------------ MENU ------------------ */
-
-
-static int game_time = 60; // default = 1 min
-static int difficulty = 0; // We have  0  ,   1     ,  2: See labels array
-const char *difficulty_labels[3] = {"Easy", "Medium", "Hard"};
-
-typedef enum {
-    MENU_MAIN,
-    MENU_PLAY,
-    MENU_DIFFICULTY,
-    MENU_TIME,
-    MENU_OPTION5
-} menu_state_t; // enum for easy operation choosing in contril int
+#define SPLASH_US        1000000 // "Menu Ready" stays until input or this timeout
 
-static menu_state_t menu_state = MENU_MAIN; 
-static int current_index = 0; // Index for state of cursor in lcd that shows oprion like: >play
-static int top_index = 0; // Index for state of last option like
-
-#define MENU_ITEMS 5
-const char *menu[MENU_ITEMS] = {
-    "Play",
-    "Difficulty",
-    "Time",
-    "Option 5",
-    "Exit"
-}; // Creating THE meny of the game. For each item we have index that is used in joystick_task
-
-
-typedef enum {
-    SCROLL_UP,
-    SCROLL_DOWN,
-    NO_SCROLL,
-    PRESS
-} joystick_event_t;
 
+static const char *TAG = "MAIN";
 
+/* ------------------ MENU ------------------ */
 
+static menu_t menu; // the logic lives in menu.c
 
 /* ------------------ I2C / LCD ------------------ */
 
 static i2c_master_bus_handle_t i2c_bus = NULL;
 static i2c_master_dev_handle_t lcd_dev_handle = NULL;
 static i2c_master_dev_handle_t rgb_dev_handle = NULL;
+static i2c_health_t *lcd_health = NULL;
+static i2c_health_t *rgb_health = NULL;
 
 
 
-/* ------------------ Helpers ------------------ */
-void format_time(int seconds, char *buf, size_t len) {
-    int minutes = seconds / 60;
-    int secs = seconds % 60;
-    snprintf(buf, len, "%d:%02d", minutes, secs);
+/* ------------------ Joystick ------------------ */
+// The stick is sampled from an esp_timer at 1 kHz. Every 2^JOY_OVERSAMPLE_SHIFT
+// reads are summed and fed to an integer IIR filter, compared to a calibrated
+// center with hysteresis, and turned into SCROLL events with auto-repeat.
+// Events go through joy_queue, so the menu task never touches the ADC.
+
+#define JOY_STEP_MS(ms) ((ms) * 1000 / (JOY_SAMPLE_US << JOY_OVERSAMPLE_SHIFT))
+
+typedef struct {
+    int32_t  acc;          // raw reads summed for the current step
+    uint8_t  acc_count;
+    int32_t  filt;         // filtered value, Q.JOY_FRAC_BITS
+    int32_t  center_acc;   // center << JOY_DRIFT_SHIFT, Q.JOY_FRAC_BITS
+    uint16_t cal_left;     // steps left of boot calibration
+    joystick_event_t held; // direction currently engaged
+    uint16_t repeat_in;    // steps until next repeat
+    uint16_t repeat_step;  // current repeat interval in steps
+} joy_state_t;
+
+static joy_state_t joy = { .cal_left = JOY_CAL_STEPS, .held = NO_SCROLL };
+static QueueHandle_t joy_queue = NULL;
+MEM_QUEUE_STORAGE(JOYSTICK, joystick_event_t);
+static esp_timer_handle_t joy_timer = NULL;
+
+static void joystick_post(joystick_event_t event) {
+    xQueueSend(joy_queue, &event, 0); // menu is busy: drop, don't block sampling
 }
 
+static void joystick_step(int32_t x) {
+    if (joy.cal_left) {
+        joy.center_acc += x;
+        if (--joy.cal_left == 0) {
+            joy.center_acc = (joy.center_acc / JOY_CAL_STEPS) << JOY_DRIFT_SHIFT;
+            joy.filt = joy.center_acc >> JOY_DRIFT_SHIFT;
+        }
+        return;
+    }
 
+    joy.filt += (x - joy.filt) >> JOY_IIR_SHIFT;
+    int32_t center = joy.center_acc >> JOY_DRIFT_SHIFT;
+    int32_t diff = (joy.filt - center) >> JOY_FRAC_BITS;
+
+    joystick_event_t dir = NO_SCROLL;
+    if (joy.held == SCROLL_UP && diff < -SCROLL_RELEASE) dir = SCROLL_UP;
+    else if (joy.held == SCROLL_DOWN && diff > SCROLL_RELEASE) dir = SCROLL_DOWN;
+    else if (diff < -SCROLL) dir = SCROLL_UP;
+    else if (diff > SCROLL) dir = SCROLL_DOWN;
+
+    if (dir == NO_SCROLL) {
+        joy.held = NO_SCROLL;
+        // Slowly pull the center towards where the released stick rests
+        if (abs(diff) < DEADZONE) joy.center_acc += joy.filt - center;
+        return;
+    }
+
+    if (dir != joy.held) {
+        joy.held = dir;
+        joy.repeat_in = JOY_STEP_MS(JOY_REPEAT_DELAY_MS);
+        joy.repeat_step = JOY_STEP_MS(JOY_REPEAT_START_MS);
+        joystick_post(dir);
+    } else if (--joy.repeat_in == 0) {
+        joystick_post(dir);
+        joy.repeat_in = joy.repeat_step;
+        joy.repeat_step -= joy.repeat_step >> 2;
+        if (joy.repeat_step < JOY_STEP_MS(JOY_REPEAT_MIN_MS)) joy.repeat_step = JOY_STEP_MS(JOY_REPEAT_MIN_MS);
+    }
+}
+
+static void joystick_sample(void *arg) {
+    joy.acc += adc1_get_raw(Y_CHANNEL);
+    if (++joy.acc_count < (1 << JOY_OVERSAMPLE_SHIFT)) return;
+
+    int32_t x = joy.acc << (JOY_FRAC_BITS - JOY_OVERSAMPLE_SHIFT); // mean in Q.4
+    joy.acc = 0;
+    joy.acc_count = 0;
+    joystick_step(x);
+}
+
+// Digital inputs (button now, module wires/keypads later) come from the
+// scanner task with the line already debounced
+static void button_event(uint8_t line, uint8_t level, void *arg) {
+    rec_log(REC_BUTTON, (line << 1) | level);
+    if (line == BUTTON && level == 0) joystick_post(PRESS);
+}
 
-/* ------------------ Joystick ------------------ */
 void joystick_init(void) {
     adc1_config_width(ADC_WIDTH);
     adc1_config_channel_atten(Y_CHANNEL, ADC_ATTEN);
 
-    gpio_config_t button_config = {
-        .pin_bit_mask = (1ULL << BUTTON),
-        .mode = GPIO_MODE_INPUT,
-        .pull_up_en = GPIO_PULLUP_ENABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE,
+    // Calibration runs in the sampler, the stick must be left alone at boot
+    joy_queue = MEM_QUEUE_CREATE(JOYSTICK, joystick_event_t);
+    const esp_timer_create_args_t timer_args = {
+        .callback = joystick_sample,
+        .name = "joystick",
+    };
+    esp_timer_create(&timer_args, &joy_timer);
+    esp_timer_start_periodic(joy_timer, JOY_SAMPLE_US);
+
+    scanner_config_t scan_cfg = {
+        .direct_mask = 1ULL << BUTTON,
+        .on_event = button_event,
     };
-    gpio_config(&button_config);
-    ESP_LOGI(TAG, "Joystick initialized");
+    ESP_ERROR_CHECK(scanner_start(&scan_cfg));
+    DLOG_I(TAG, "Joystick initialized");
 }
 
 joystick_event_t joystick_read_event(void) {
-    static joystick_event_t last_event = NO_SCROLL;
-    joystick_event_t new_event = NO_SCROLL;
-
-    int16_t y_value = adc1_get_raw(Y_CHANNEL);
-    int button_state = gpio_get_level(BUTTON);
-
-    // Button debounce
-    if (button_state == 0) {
-        vTaskDelay(pdMS_TO_TICKS(20));
-        if (gpio_get_level(BUTTON) == 0) new_event = PRESS;
-    } else {
-        int16_t y_diff = y_value - 2048;
-        if (abs(y_diff) > SCROLL) {
-            if (y_diff < 0) new_event = SCROLL_UP;
-            else new_event = SCROLL_DOWN;
-        }
-    }
-
-    // Trigger only on edge
-    if (new_event != NO_SCROLL && new_event != last_event) {
-        last_event = new_event;
-        return new_event;
-    }
-
-    if (new_event == NO_SCROLL) last_event = NO_SCROLL;
+    joystick_event_t event;
+    if (joy_queue && xQueueReceive(joy_queue, &event, 0) == pdTRUE) return event;
     return NO_SCROLL;
- } 
+}
 
 /* ------------------ I2C + Devices ------------------ */
 
@@ -142,167 +210,393 @@ static esp_err_t i2c_init_bus(void) {
         .scl_io_num = PIN_NUM_SCL,
         .flags.enable_internal_pullup = true,
     };
+    lcd_health = i2c_health_dev(LCD_ADDRESS);
+    rgb_health = i2c_health_dev(RGB_ADDRESS);
     return i2c_new_master_bus(&bus_cfg, &i2c_bus);
 }
 
+// A device stuck mid-byte holds SDA low until it gets the clocks it expects.
+// Clock SCL by hand until SDA is released (at most 9 times), send a STOP,
+// then hand the pins back to the controller and reset its state machine.
+// Only the menu task uses the bus, so nothing is in flight here.
+static esp_err_t i2c_bus_recover(void) {
+    gpio_set_level(PIN_NUM_SCL, 1); // released before the pins become GPIOs
+    gpio_set_level(PIN_NUM_SDA, 1);
+    gpio_set_direction(PIN_NUM_SCL, GPIO_MODE_INPUT_OUTPUT_OD);
+    gpio_set_direction(PIN_NUM_SDA, GPIO_MODE_INPUT_OUTPUT_OD);
+    esp_rom_gpio_connect_out_signal(PIN_NUM_SCL, SIG_GPIO_OUT_IDX, false, false);
+    esp_rom_gpio_connect_out_signal(PIN_NUM_SDA, SIG_GPIO_OUT_IDX, false, false);
+
+    for (int i = 0; i < 9 && !gpio_get_level(PIN_NUM_SDA); i++) {
+        gpio_set_level(PIN_NUM_SCL, 0);
+        esp_rom_delay_us(I2C_CLEAR_HALF_US);
+        gpio_set_level(PIN_NUM_SCL, 1);
+        esp_rom_delay_us(I2C_CLEAR_HALF_US);
+    }
+    // STOP: SDA rises while SCL is high
+    gpio_set_level(PIN_NUM_SCL, 0);
+    gpio_set_level(PIN_NUM_SDA, 0);
+    esp_rom_delay_us(I2C_CLEAR_HALF_US);
+    gpio_set_level(PIN_NUM_SCL, 1);
+    esp_rom_delay_us(I2C_CLEAR_HALF_US);
+    gpio_set_level(PIN_NUM_SDA, 1);
+    esp_rom_delay_us(I2C_CLEAR_HALF_US);
+    bool released = gpio_get_level(PIN_NUM_SDA);
+
+    esp_rom_gpio_connect_out_signal(PIN_NUM_SCL, i2c_periph_signal[I2C_BUS_PORT].scl_out_sig, false, false);
+    esp_rom_gpio_connect_out_signal(PIN_NUM_SDA, i2c_periph_signal[I2C_BUS_PORT].sda_out_sig, false, false);
+    esp_err_t r = i2c_master_bus_reset(i2c_bus);
+    if (r == ESP_OK && !released) r = ESP_ERR_INVALID_STATE;
+
+    i2c_health_recovered(r == ESP_OK);
+    DLOG_W(TAG, "I2C bus recovery %s", r == ESP_OK ? "ok" : "failed, SDA still low");
+    return r;
+}
+
+// Counts the result, a stuck bus is recovered right away for the next caller
+static esp_err_t i2c_account(i2c_health_t *h, esp_err_t r, int64_t start) {
+    int64_t end = esp_timer_get_time();
+    i2c_result_t res = i2c_health_classify(r, r != ESP_OK && !gpio_get_level(PIN_NUM_SDA));
+    if (i2c_health_record(h, res, (uint32_t)(end - start), end)) i2c_bus_recover();
+    return r;
+}
+
+// Every transmit goes through here, a device that is down fails without
+// touching the bus until i2c_service() re-probes it
+static esp_err_t i2c_transmit(i2c_master_dev_handle_t dev, i2c_health_t *h, const uint8_t *buf, size_t len) {
+    if (!dev) return ESP_ERR_INVALID_STATE;
+    if (!i2c_health_allow(h)) return ESP_ERR_NOT_FINISHED;
+
+    int64_t start = esp_timer_get_time();
+    return i2c_account(h, i2c_master_transmit(dev, buf, len, I2C_XFER_TIMEOUT_MS), start);
+}
+
+static esp_err_t i2c_reprobe(i2c_health_t *h) {
+    int64_t start = esp_timer_get_time();
+    return i2c_account(h, i2c_master_probe(i2c_bus, h->addr, I2C_XFER_TIMEOUT_MS), start);
+}
+
 static esp_err_t lcd_add_device(void) {
+    if (lcd_dev_handle) return ESP_OK; // re-init after the LCD came back
     i2c_device_config_t dev_cfg = {
         .dev_addr_length = I2C_ADDR_BIT_7,
         .device_address  = LCD_ADDRESS,
-        .scl_speed_hz    = I2C_MASTER_FREQ_HZ,
+        .scl_speed_hz    = MIN(i2c_tune_speed(LCD_ADDRESS, I2C_MASTER_FREQ_HZ), LCD_MAX_SCL_HZ),
     };
     return i2c_master_bus_add_device(i2c_bus, &dev_cfg, &lcd_dev_handle);
 }
 
-static esp_err_t rgb_add_device_and_init(void) {
+static esp_err_t rgb_add_device(void) {
+    if (rgb_dev_handle) return ESP_OK;
     i2c_device_config_t dev_cfg = {
         .dev_addr_length = I2C_ADDR_BIT_7,
         .device_address  = RGB_ADDRESS,
-        .scl_speed_hz    = I2C_MASTER_FREQ_HZ,
-    };
-    esp_err_t r = i2c_master_bus_add_device(i2c_bus, &dev_cfg, &rgb_dev_handle);
-    if (r != ESP_OK) return r;
-
-    uint8_t init_data[][2] = {
-        {0x80, 0x01},{0x81, 0x14},{0x82, 0xFF},
-        {0x83, 0xFF},{0x84, 0xFF},{0x85, 0x20}
+        .scl_speed_hz    = i2c_tune_speed(RGB_ADDRESS, I2C_MASTER_FREQ_HZ),
     };
+    return i2c_master_bus_add_device(i2c_bus, &dev_cfg, &rgb_dev_handle);
+}
 
-    for (size_t i = 0; i < sizeof(init_data)/sizeof(init_data[0]); i++) {
-        i2c_master_transmit(rgb_dev_handle, init_data[i], 2, pdMS_TO_TICKS(100));
-        vTaskDelay(pdMS_TO_TICKS(10));
-    }
-    return ESP_OK;
+static esp_err_t rgb_write_reg(uint8_t reg, uint8_t val) {
+    uint8_t buf[2] = {reg, val};
+    return i2c_transmit(rgb_dev_handle, rgb_health, buf, 2);
 }
 
 /* ------------------ LCD helpers ------------------ */
 
-static esp_err_t lcd_cmd(uint8_t cmd) {
+// Sends the command only, the caller owns the execution time
+static esp_err_t lcd_cmd_raw(uint8_t cmd) {
     uint8_t buf[2] = {0x00, cmd};
-    esp_err_t r = i2c_master_transmit(lcd_dev_handle, buf, 2, pdMS_TO_TICKS(100));
+    return i2c_transmit(lcd_dev_handle, lcd_health, buf, 2);
+}
+
+static esp_err_t lcd_cmd(uint8_t cmd) {
+    esp_err_t r = lcd_cmd_raw(cmd);
     if (r == ESP_OK) {
-        if (cmd == 0x01 || cmd == 0x02) vTaskDelay(pdMS_TO_TICKS(5));
-        else vTaskDelay(pdMS_TO_TICKS(2));
+        esp_rom_delay_us((cmd == 0x01 || cmd == 0x02) ? LCD_CLEAR_US : LCD_CMD_US);
     }
     return r;
 }
 
-static esp_err_t lcd_data(uint8_t data) {
-    uint8_t buf[2] = {0x40, data};
-    return i2c_master_transmit(lcd_dev_handle, buf, 2, pdMS_TO_TICKS(100));
+// The whole line goes out as one transaction: control byte 0x40 (Co=0, RS=1)
+// followed by 16 data bytes, instead of one transaction per character
+static esp_err_t lcd_write_line(uint8_t row, const text_line_t *line) {
+    uint8_t buf[1 + TEXT_COLS];
+    uint8_t addr = (row == 0 ? 0x00 : 0x40);
+
+    esp_err_t r = lcd_cmd(0x80 | addr);
+    if (r != ESP_OK) return r;
+
+    buf[0] = 0x40;
+    for (int i = 0; i < TEXT_COLS; i++) buf[1 + i] = (uint8_t)line->c[i];
+    return i2c_transmit(lcd_dev_handle, lcd_health, buf, sizeof(buf));
+}
+
+static bool lcd_hold = false; // LCD is being re-initialized, redrawn afterwards
+
+static void lcd_write_text(uint8_t row, const text_line_t *line) {
+    if (lcd_hold) return;
+    lcd_write_line(row, line); // errors are counted in i2c_health, a dead LCD fails fast
 }
 
-static void lcd_write_str(const char *str) {
-    while (*str) {
-        lcd_data((uint8_t)*str++);
-        vTaskDelay(pdMS_TO_TICKS(10));
+/* ------------------ Init orchestrator ------------------ */
+// Every device lists its init steps and the minimum time that must pass
+// before its next step. init_run() interleaves the devices, so while one
+// waits (LCD follower settling) the others keep going.
+
+typedef esp_err_t (*init_fn_t)(uint32_t arg);
+
+typedef struct {
+    const char *name;
+    init_fn_t   fn;
+    uint32_t    arg;
+    uint32_t    delay_us;   // minimum wait before the next step of this device
+} init_step_t;
+
+typedef struct {
+    const char        *name;
+    const init_step_t *steps;
+    size_t             n_steps;
+    uint32_t           power_on_us; // before the first step
+    i2c_health_t     **health;      // NULL if not on the bus
+    int64_t            ready_at;    // esp_timer time (since boot) of the next step
+    size_t             next;
+    esp_err_t          err;
+    bool               restarting;  // re-init after the device came back
+} init_device_t;
+
+typedef struct {
+    const char *dev;
+    const char *step;
+    int64_t     start_us;
+    uint32_t    dur_us;
+} init_stat_t;
+
+#define INIT_MAX_STATS 32
+static init_stat_t init_stats[INIT_MAX_STATS];
+static size_t init_stat_count = 0;
+
+static esp_err_t init_lcd_add(uint32_t arg)  { return lcd_add_device(); }
+static esp_err_t init_lcd_cmd(uint32_t arg)  { return lcd_cmd_raw((uint8_t)arg); }
+static esp_err_t init_rgb_add(uint32_t arg)  { return rgb_add_device(); }
+static esp_err_t init_rgb_reg(uint32_t arg)  { return rgb_write_reg(arg >> 8, arg & 0xFF); }
+static esp_err_t init_joystick(uint32_t arg) { joystick_init(); return ESP_OK; }
+
+static const init_step_t lcd_init_steps[] = {
+    {"add",        init_lcd_add, 0,           0},
+    {"func",       init_lcd_cmd, 0x38,        LCD_CMD_US},
+    {"func ext",   init_lcd_cmd, 0x39,        LCD_CMD_US},
+    {"osc",        init_lcd_cmd, 0x14,        LCD_CMD_US},
+    {"contrast",   init_lcd_cmd, 0x70 | 0x0F, LCD_CMD_US},
+    {"power",      init_lcd_cmd, 0x5C,        LCD_CMD_US},
+    {"follower",   init_lcd_cmd, 0x6C,        LCD_FOLLOWER_US},
+    {"func",       init_lcd_cmd, 0x38,        LCD_CMD_US},
+    {"display on", init_lcd_cmd, 0x0C,        LCD_CMD_US},
+    {"clear",      init_lcd_cmd, 0x01,        LCD_CLEAR_US},
+};
+
+#define RGB_REG(reg, val) (((reg) << 8) | (val))
+static const init_step_t rgb_init_steps[] = {
+    {"add", init_rgb_add, 0,                   0},
+    {"mode1", init_rgb_reg, RGB_REG(0x80, 0x01), RGB_OSC_US},
+    {"mode2", init_rgb_reg, RGB_REG(0x81, 0x14), 0},
+    {"pwm0",  init_rgb_reg, RGB_REG(0x82, 0xFF), 0},
+    {"pwm1",  init_rgb_reg, RGB_REG(0x83, 0xFF), 0},
+    {"pwm2",  init_rgb_reg, RGB_REG(0x84, 0xFF), 0},
+    {"pwm3",  init_rgb_reg, RGB_REG(0x85, 0x20), 0},
+};
+
+static const init_step_t joystick_init_steps[] = {
+    {"adc+scanner", init_joystick, 0, 0},
+};
+
+// LCD power-on time counts from reset, which esp_timer also does
+#define INIT_DEVICE(n, steps, power_on_us, health) \
+    {n, steps, sizeof(steps)/sizeof(steps[0]), power_on_us, health, power_on_us, 0, ESP_OK, false}
+
+static init_device_t init_devices[] = {
+    // The LCD comes first, i2c_service() finds it there
+    INIT_DEVICE("lcd",      lcd_init_steps,      LCD_POWER_ON_US, &lcd_health),
+    INIT_DEVICE("rgb",      rgb_init_steps,      0,               &rgb_health),
+    INIT_DEVICE("joystick", joystick_init_steps, 0,               NULL),
+};
+#define INIT_DEVICES (sizeof(init_devices)/sizeof(init_devices[0]))
+
+static void init_run_step(init_device_t *d) {
+    const init_step_t *s = &d->steps[d->next];
+    int64_t start = esp_timer_get_time();
+    esp_err_t r = s->fn(s->arg);
+    int64_t end = esp_timer_get_time();
+
+    if (init_stat_count < INIT_MAX_STATS) {
+        init_stats[init_stat_count++] = (init_stat_t){
+            .dev = d->name, .step = s->name,
+            .start_us = start, .dur_us = (uint32_t)(end - start),
+        };
     }
+
+    if (r != ESP_OK) {
+        d->err = r;
+        d->next = d->n_steps; // give up on this device, the others go on
+        if (d->health) i2c_health_mark_down(*d->health, end); // i2c_service() retries it
+        return;
+    }
+    d->next++;
+    d->ready_at = end + s->delay_us;
 }
 
+// Runs every step that is due, waits up to INIT_SPIN_US are spun instead
+// of left for the next call. Returns when the next step is due, INT64_MAX
+// once every device is done.
+static int64_t init_poll(void) {
+    int64_t next_ready = INT64_MAX;
+
+    for (size_t i = 0; i < INIT_DEVICES; i++) {
+        init_device_t *d = &init_devices[i];
+        while (d->next < d->n_steps) {
+            int64_t wait = d->ready_at - esp_timer_get_time();
+            if (wait > INIT_SPIN_US) break;
+            if (wait > 0) esp_rom_delay_us((uint32_t)wait);
+            init_run_step(d);
+        }
 
-/* New: write full padded line */
+        // A device is ready once its last step's delay has also passed
+        bool busy = d->next < d->n_steps ||
+                    (d->err == ESP_OK && d->ready_at > esp_timer_get_time());
+        if (busy) {
+            if (d->ready_at < next_ready) next_ready = d->ready_at;
+        } else if (d->err == ESP_OK) {
+            d->restarting = false;
+        }
+    }
+    return next_ready;
+}
 
+static void init_run(void) {
+    int64_t next_ready;
 
-static void lcd_write_line(uint8_t row, const char *text) {
-    char buf[17];
-    snprintf(buf, sizeof(buf), "%-16s", text); // left align, pad spaces
-    uint8_t addr = (row == 0 ? 0x00 : 0x40);
-    lcd_cmd(0x80 | addr);
-    lcd_write_str(buf);
+    while ((next_ready = init_poll()) != INT64_MAX) {
+        // Only sub-millisecond waits are spun, anything longer
+        // sleeps (at least one tick) so the CPU is free meanwhile
+        int64_t wait = next_ready - esp_timer_get_time();
+        TickType_t ticks = wait / (portTICK_PERIOD_MS * 1000);
+        if (wait >= 1000) vTaskDelay(ticks > 0 ? ticks : 1);
+        else if (wait > 0) esp_rom_delay_us((uint32_t)wait);
+    }
 }
 
-static esp_err_t lcd_init_display(void) {
-    vTaskDelay(pdMS_TO_TICKS(50));
-    lcd_cmd(0x38); lcd_cmd(0x39); lcd_cmd(0x14);
-    lcd_cmd(0x70 | 0x0F); lcd_cmd(0x5C); lcd_cmd(0x6C);
-    vTaskDelay(pdMS_TO_TICKS(200));
-    lcd_cmd(0x38); lcd_cmd(0x0C); lcd_cmd(0x01);
-    ESP_LOGI(TAG, "LCD initialised");
-    return ESP_OK;
+/* ------------------ I2C service ------------------ */
+// Called from every menu loop pass: re-probes devices that are down once
+// their backoff has passed. A device that answers again may have lost power
+// with its cable, so its init sequence runs again, a few due steps per pass
+// (init_poll), while the menu keeps going. Menu output waits meanwhile.
+// Returns true once the LCD is re-initialized and needs a redraw.
+
+static bool i2c_service(int64_t now) {
+    init_device_t *lcd = &init_devices[0];
+    bool was_restarting = lcd->restarting;
+    i2c_health_t *h;
+
+    if (!i2c_bus) return false;
+
+    while ((h = i2c_health_probe_due(now)) != NULL) {
+        if (i2c_reprobe(h) != ESP_OK) continue; // record() moved retry_at on
+
+        DLOG_I(TAG, "I2C device 0x%02x is back", h->addr);
+        for (size_t i = 0; i < INIT_DEVICES; i++) {
+            init_device_t *d = &init_devices[i];
+            if (!d->health || *d->health != h) continue;
+            d->next = 0;
+            d->err = ESP_OK;
+            d->ready_at = esp_timer_get_time() + d->power_on_us;
+            d->restarting = true;
+        }
+    }
+    init_poll();
+
+    lcd_hold = lcd->restarting;
+    return was_restarting && !lcd->restarting && lcd->err == ESP_OK;
 }
 
-static void lcd_render_menu(void) {
-    char line0[17], line1[17];
-    snprintf(line0, sizeof(line0), "%c%s", (top_index==current_index)?'>':' ', menu[top_index]);
-    lcd_write_line(0, line0);
+static void init_log_stats(void) {
+    for (size_t i = 0; i < INIT_DEVICES; i++) {
+        if (init_devices[i].err != ESP_OK)
+            DLOG_E(TAG, "%s init failed: %s", init_devices[i].name, esp_err_to_name(init_devices[i].err));
+    }
+    for (size_t i = 0; i < init_stat_count; i++) {
+        DLOG_I(TAG, "init %-8s %-10s at %7lu us took %5lu us",
+               init_stats[i].dev, init_stats[i].step,
+               (uint32_t)init_stats[i].start_us, init_stats[i].dur_us);
+    }
+}
+
+/* ------------------ Console ------------------ */
+// 'd' dumps the session recording (feed it to host/replay),
+// 'r' replays it on the device against a scratch menu,
+// 'm' prints stack high-water marks and heap statistics,
+// 'i' prints the I2C bus health counters
+
+static uint8_t replay_buf[REC_BUF_SIZE];
+
+static void replay_write_line(uint8_t row, const text_line_t *line) {}
 
-    if (top_index+1 < MENU_ITEMS) {
-        snprintf(line1, sizeof(line1), "%c%s", (top_index+1==current_index)?'>':' ', menu[top_index+1]);
-        lcd_write_line(1, line1);
-    } else {
-        lcd_write_line(1, "");
+static void replay_on_device(void) {
+    int64_t base_us;
+    uint32_t dropped;
+    size_t len = rec_snapshot(replay_buf, sizeof(replay_buf), &base_us, &dropped);
+    if (!replay_can_start(replay_buf, len, dropped)) {
+        printf("replay refused: %lu records dropped and no checkpoint to start from\n", (unsigned long)dropped);
+        return;
     }
+    menu_t scratch;
+    countdown_t countdown = {0};
+    replay_stats_t stats;
+    menu_init(&scratch, replay_write_line);
+
+    int64_t start = esp_timer_get_time();
+    bool ok = replay_run(replay_buf, len, base_us, &scratch, &countdown, &stats);
+    int64_t took = esp_timer_get_time() - start;
+
+    printf("replay %s: %lu records over %lld us in %lld us, %lu checkpoint mismatches, menu state %d cursor %d\n",
+           ok ? "ok" : "truncated", (unsigned long)stats.records,
+           (long long)(stats.last_us - stats.first_us), (long long)took,
+           (unsigned long)stats.checkpoint_mismatches, scratch.state, scratch.current_index);
+}
+
+static void console_poll(void) {
+    int c = getchar(); // console stdin does not block
+    if (c == EOF) {
+        clearerr(stdin);
+        return;
+    }
+    if (c == 'd') rec_dump();
+    else if (c == 'r') replay_on_device();
+    else if (c == 'm') mem_report();
+    else if (c == 'i') i2c_health_print();
 }
 
 /* ------------------ Menu Task ------------------ */ 
 
-void joystick_task(void *pvParameters) {
-    joystick_init();
-    lcd_render_menu();
+MEM_TASK_STORAGE(JOYSTICK);
+
+// Only between messages: a message's timeout is not part of the checkpoint
+static void menu_checkpoint(int64_t now) {
+    if (menu.message_until || !rec_checkpoint_due()) return;
+    rec_checkpoint_at(REC_CHECKPOINT_MENU, rec_menu_pack(&(rec_menu_state_t){
+        .menu_state = menu.state, .cursor = menu.current_index, .top = menu.top_index,
+        .difficulty = menu.difficulty, .game_time = menu.game_time,
+    }), now);
+}
 
+void joystick_task(void *pvParameters) {
     while (1) {
         joystick_event_t event = joystick_read_event();
+        int64_t now = esp_timer_get_time();
 
-        switch (menu_state) {
-        case MENU_MAIN:
-            if (event == SCROLL_UP && current_index > 0) {
-                current_index--;
-                if (current_index < top_index) top_index--;
-                lcd_render_menu();
-            } else if (event == SCROLL_DOWN && current_index < MENU_ITEMS-1) {
-                current_index++;
-                if (current_index > top_index+1) top_index++;
-                lcd_render_menu();
-            } else if (event == PRESS) {
-                if (current_index == 0) menu_state = MENU_PLAY;
-                else if (current_index == 1) menu_state = MENU_DIFFICULTY;
-                else if (current_index == 2) menu_state = MENU_TIME;
-                else if (current_index == 3) menu_state = MENU_OPTION5;
-                else if (current_index == 4) {
-                    lcd_write_line(0, "Goodbye!");
-                    lcd_write_line(1, "");
-                    vTaskDelay(pdMS_TO_TICKS(2000));
-                }
-            }
-            break;
-
-        case MENU_PLAY:
-            lcd_write_line(0, "Game Starting...");
-            lcd_write_line(1, "");
-            vTaskDelay(pdMS_TO_TICKS(2000));
-            menu_state = MENU_MAIN;
-            lcd_render_menu();
-            break;
-
-        case MENU_DIFFICULTY:
-            if (event == SCROLL_UP && difficulty < 2) difficulty++;
-            else if (event == SCROLL_DOWN && difficulty > 0) difficulty--;
-            else if (event == PRESS) { menu_state = MENU_MAIN; lcd_render_menu(); break; }
-
-            lcd_write_line(0, "Difficulty:");
-            lcd_write_line(1, difficulty_labels[difficulty]);
-            break;
-
-        case MENU_TIME: {
-            if (event == SCROLL_UP && game_time < 300) game_time += 30;
-            else if (event == SCROLL_DOWN && game_time > 60) game_time -= 30;
-            else if (event == PRESS) { menu_state = MENU_MAIN; lcd_render_menu(); break; }
-
-            char buf[16];
-            format_time(game_time, buf, sizeof(buf));
-            lcd_write_line(0, "Set Time:");
-            lcd_write_line(1, buf);
-            break;
-        }
-
-        case MENU_OPTION5:
-            lcd_write_line(0, "Option 5 TBD");
-            lcd_write_line(1, "");
-            vTaskDelay(pdMS_TO_TICKS(2000));
-            menu_state = MENU_MAIN;
-            lcd_render_menu();
-            break;
-        }
+        if (event != NO_SCROLL) rec_log_at(REC_JOYSTICK, event, now);
+        menu_handle_event(&menu, event, now);
+        menu_checkpoint(now);
+        if (i2c_service(now)) menu_redraw(&menu);
+        console_poll();
 
         vTaskDelay(pdMS_TO_TICKS(50));
     }
@@ -310,16 +604,19 @@ void joystick_task(void *pvParameters) {
 
 /* ------------------ MAIN ------------------ */
 void app_main(void) {
-    ESP_LOGI(TAG, "Starting");
+    dlog_start();
+    DLOG_I(TAG, "Starting");
 
+    // Tuned bus speeds are in NVS, written by the i2c scanner firmware
+    if (i2c_tune_init() != ESP_OK) DLOG_W(TAG, "NVS unavailable, I2C runs at %d Hz", I2C_MASTER_FREQ_HZ);
     i2c_init_bus();
-    lcd_add_device();
-    rgb_add_device_and_init();
-    lcd_init_display();
+    init_run();
 
-    lcd_write_line(0, "Menu Ready");
-    lcd_write_line(1, "Use Joystick");
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    // Splash stays until the first input or SPLASH_US, without blocking
+    menu_init(&menu, lcd_write_text);
+    menu_show_message(&menu, "Menu Ready", "Use Joystick", esp_timer_get_time() + SPLASH_US, true);
+    MEM_TASK_CREATE(JOYSTICK, joystick_task, NULL);
 
-    xTaskCreate(joystick_task, "joystick_task", 4096, NULL, 5, NULL);
+    DLOG_I(TAG, "Menu ready %lu us after reset", (uint32_t)esp_timer_get_time());
+    init_log_stats();
 }
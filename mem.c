@@ -0,0 +1,29 @@
+#include <stdio.h>
+#include "mem.h"
+#include "esp_heap_caps.h"
+
+#define MEM_TASK_NAME_(id, name, stack, prio) name,
+#define MEM_TASK_SIZE_(id, name, stack, prio) (stack),
+
+const char *const mem_task_names[MEM_TASK_COUNT] = { MEM_TASKS(MEM_TASK_NAME_) };
+static const uint32_t mem_task_stacks[MEM_TASK_COUNT] = { MEM_TASKS(MEM_TASK_SIZE_) };
+static TaskHandle_t mem_tasks[MEM_TASK_COUNT];
+
+TaskHandle_t mem_task_register(mem_task_t id, TaskHandle_t handle) {
+    if (id < MEM_TASK_COUNT) mem_tasks[id] = handle;
+    return handle;
+}
+
+void mem_report(void) {
+    printf("task            stack  min free   used\n");
+    for (int i = 0; i < MEM_TASK_COUNT; i++) {
+        if (!mem_tasks[i]) continue;
+        uint32_t free_min = uxTaskGetStackHighWaterMark(mem_tasks[i]); // bytes on ESP-IDF
+        printf("%-14s %6lu %9lu %6lu\n", mem_task_names[i], (unsigned long)mem_task_stacks[i],
+               (unsigned long)free_min, (unsigned long)(mem_task_stacks[i] - free_min));
+    }
+    printf("heap: free %u, min free %u, largest block %u\n",
+           (unsigned)heap_caps_get_free_size(MALLOC_CAP_8BIT),
+           (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT),
+           (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+}
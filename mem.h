@@ -0,0 +1,47 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "mem_config.h"
+
+/* ------------------ Static allocation ------------------ */
+// Tasks and queues from the tables in mem_config.h. A module declares the
+// storage at file scope and creates from it:
+//   MEM_TASK_STORAGE(DLOG);          ... MEM_TASK_CREATE(DLOG, dlog_task, NULL);
+//   MEM_QUEUE_STORAGE(SCANNER, ev_t); ... q = MEM_QUEUE_CREATE(SCANNER, ev_t);
+// so a firmware only pays for the tasks it actually runs.
+
+#define MEM_TASK_ENUM_(id, name, stack, prio)  MEM_TASK_##id,
+#define MEM_TASK_STACK_(id, name, stack, prio) MEM_STACK_##id = (stack),
+#define MEM_TASK_PRIO_(id, name, stack, prio)  MEM_PRIO_##id = (prio),
+
+typedef enum { MEM_TASKS(MEM_TASK_ENUM_) MEM_TASK_COUNT } mem_task_t;
+enum { MEM_TASKS(MEM_TASK_STACK_) };
+enum { MEM_TASKS(MEM_TASK_PRIO_) };
+
+extern const char *const mem_task_names[MEM_TASK_COUNT];
+
+#define MEM_TASK_STORAGE(id) \
+    static StackType_t mem_stack_##id[MEM_STACK_##id]; \
+    static StaticTask_t mem_tcb_##id
+
+#define MEM_TASK_CREATE(id, fn, arg) \
+    mem_task_register(MEM_TASK_##id, xTaskCreateStatic((fn), mem_task_names[MEM_TASK_##id], \
+        MEM_STACK_##id, (arg), MEM_PRIO_##id, mem_stack_##id, &mem_tcb_##id))
+
+#define MEM_TASK_CREATE_PINNED(id, fn, arg, core) \
+    mem_task_register(MEM_TASK_##id, xTaskCreateStaticPinnedToCore((fn), mem_task_names[MEM_TASK_##id], \
+        MEM_STACK_##id, (arg), MEM_PRIO_##id, mem_stack_##id, &mem_tcb_##id, (core)))
+
+#define MEM_QUEUE_STORAGE(id, type) \
+    static uint8_t mem_qbuf_##id[MEM_QLEN_##id * sizeof(type)]; \
+    static StaticQueue_t mem_queue_##id
+
+#define MEM_QUEUE_CREATE(id, type) \
+    xQueueCreateStatic(MEM_QLEN_##id, sizeof(type), mem_qbuf_##id, &mem_queue_##id)
+
+// Adds a task to the report, also for tasks we did not create (main)
+TaskHandle_t mem_task_register(mem_task_t id, TaskHandle_t handle);
+
+// Stack high-water mark of every registered task plus heap statistics
+void mem_report(void);
@@ -0,0 +1,28 @@
+#pragma once
+
+/* ------------------ Memory config ------------------ */
+// Every task, queue and large buffer of all the firmwares is sized here.
+// Tasks and queues are allocated statically through mem.h, so the link map
+// shows the real RAM use. mem_report() ('m' on the console) prints the stack
+// high-water marks to shrink these with.
+
+//  id          name             stack bytes                      priority
+#define MEM_TASKS(X) \
+    X(MAIN,     "main",          CONFIG_ESP_MAIN_TASK_STACK_SIZE, 1) \
+    X(JOYSTICK, "joystick_task", 4096,                            5) \
+    X(SCANNER,  "scanner",       2048,                            6) \
+    X(DLOG,     "dlog",          3072,                            1) \
+    X(I2C_SCAN, "i2cscanner",    6144,                            5) \
+    X(CONSOLE,  "console",       3072,                            0)
+
+// Queue lengths (items)
+#define MEM_QLEN_JOYSTICK 4  // short, so releasing the stick stops scrolling at once
+#define MEM_QLEN_SCANNER  16
+
+// Buffers
+#ifndef REC_BUF_SIZE
+#define REC_BUF_SIZE 4096 // session recording, bytes, power of two
+#endif
+#ifndef DLOG_RING_LEN
+#define DLOG_RING_LEN 64  // deferred log records, power of two
+#endif
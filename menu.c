@@ -0,0 +1,149 @@
+#include <stdbool.h>
+#include "menu.h"
+
+#define MESSAGE_US 2000000
+
+const char *difficulty_labels[3] = {"Easy", "Medium", "Hard"};
+
+const char *menu_items[MENU_ITEMS] = {
+    "Play",
+    "Difficulty",
+    "Time",
+    "Option 5",
+    "Exit"
+}; // Creating THE meny of the game. For each item we have index that is used in menu_handle_event
+
+/* ------------------ Helpers ------------------ */
+static void write_str(menu_t *m, uint8_t row, const char *text) {
+    text_line_t line;
+    text_clear(&line);
+    text_put_str(&line, 0, text);
+    m->write_line(row, &line);
+}
+
+void menu_init(menu_t *m, menu_write_line_fn write_line) {
+    *m = (menu_t){
+        .state = MENU_MAIN,
+        .game_time = 60, // default = 1 min
+        .difficulty = 0,
+        .write_line = write_line,
+    };
+}
+
+static void menu_render_item(menu_t *m, uint8_t row) {
+    text_line_t line;
+    int index = m->top_index + row;
+
+    text_clear(&line);
+    if (index < MENU_ITEMS) {
+        text_put_cursor(&line, index == m->current_index);
+        text_put_str(&line, 1, menu_items[index]);
+    }
+    m->write_line(row, &line);
+}
+
+void menu_render(menu_t *m) {
+    menu_render_item(m, 0);
+    menu_render_item(m, 1);
+}
+
+static void menu_render_difficulty(menu_t *m) {
+    write_str(m, 0, "Difficulty:");
+    write_str(m, 1, difficulty_labels[m->difficulty]);
+}
+
+static void menu_render_time(menu_t *m) {
+    text_line_t line;
+    text_clear(&line);
+    text_put_mss(&line, 0, m->game_time);
+    write_str(m, 0, "Set Time:");
+    m->write_line(1, &line);
+}
+
+static void menu_set_message(menu_t *m, int64_t until_us, bool skippable) {
+    m->message_until = until_us;
+    m->message_skippable = skippable;
+}
+
+void menu_redraw(menu_t *m) {
+    if (m->state == MENU_DIFFICULTY) menu_render_difficulty(m);
+    else if (m->state == MENU_TIME) menu_render_time(m);
+    else menu_render(m);
+}
+
+void menu_show_message(menu_t *m, const char *line0, const char *line1,
+                       int64_t until_us, bool skippable) {
+    write_str(m, 0, line0);
+    write_str(m, 1, line1);
+    menu_set_message(m, until_us, skippable);
+}
+
+void menu_handle_event(menu_t *m, joystick_event_t event, int64_t now_us) {
+    if (m->message_until) {
+        bool expired = now_us >= m->message_until;
+        if (!expired && !(m->message_skippable && event != NO_SCROLL)) return; // input is dropped
+        m->message_until = 0;
+        m->state = MENU_MAIN;
+        menu_render(m);
+    }
+
+    switch (m->state) {
+    case MENU_MAIN:
+        if (event == SCROLL_UP && m->current_index > 0) {
+            m->current_index--;
+            if (m->current_index < m->top_index) m->top_index--;
+            menu_render(m);
+        } else if (event == SCROLL_DOWN && m->current_index < MENU_ITEMS-1) {
+            m->current_index++;
+            if (m->current_index > m->top_index+1) m->top_index++;
+            menu_render(m);
+        } else if (event == PRESS) {
+            if (m->current_index == 0) {
+                // Seeded from the press time, so a replay builds the same bomb
+                text_line_t serial;
+                bomb_generate(&m->bomb, (uint32_t)now_us, m->difficulty);
+                text_clear(&serial);
+                text_put_str(&serial, text_put_str(&serial, 0, "SN "), m->bomb.serial);
+
+                m->state = MENU_PLAY;
+                write_str(m, 0, "Game Starting...");
+                m->write_line(1, &serial);
+                menu_set_message(m, now_us + MESSAGE_US, false);
+            } else if (m->current_index == 1) {
+                m->state = MENU_DIFFICULTY;
+                menu_render_difficulty(m);
+            } else if (m->current_index == 2) {
+                m->state = MENU_TIME;
+                menu_render_time(m);
+            } else if (m->current_index == 3) {
+                m->state = MENU_OPTION5;
+                menu_show_message(m, "Option 5 TBD", "", now_us + MESSAGE_US, false);
+            } else if (m->current_index == 4) {
+                menu_show_message(m, "Goodbye!", "", now_us + MESSAGE_US, false);
+            }
+        }
+        break;
+
+    case MENU_PLAY:
+    case MENU_OPTION5:
+        break; // only shown as a message, see above
+
+    case MENU_DIFFICULTY:
+        if (event == SCROLL_UP && m->difficulty < 2) m->difficulty++;
+        else if (event == SCROLL_DOWN && m->difficulty > 0) m->difficulty--;
+        else if (event == PRESS) { m->state = MENU_MAIN; menu_render(m); break; }
+        else break;
+
+        menu_render_difficulty(m);
+        break;
+
+    case MENU_TIME:
+        if (event == SCROLL_UP && m->game_time < 300) m->game_time += 30;
+        else if (event == SCROLL_DOWN && m->game_time > 60) m->game_time -= 30;
+        else if (event == PRESS) { m->state = MENU_MAIN; menu_render(m); break; }
+        else break;
+
+        menu_render_time(m);
+        break;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "bomb.h"
+#include "text.h"
+
+/* ------------------ MENU ------------------ */
+// Menu logic without any hardware: input comes in as joystick events with a
+// timestamp, output goes out through write_line(). lcd.c drives it from the
+// joystick task, replay.c drives it from a recording.
+
+typedef enum {
+    SCROLL_UP,
+    SCROLL_DOWN,
+    NO_SCROLL,
+    PRESS
+} joystick_event_t;
+
+typedef enum {
+    MENU_MAIN,
+    MENU_PLAY,
+    MENU_DIFFICULTY,
+    MENU_TIME,
+    MENU_OPTION5
+} menu_state_t; // enum for easy operation choosing in contril int
+
+typedef void (*menu_write_line_fn)(uint8_t row, const text_line_t *line);
+
+typedef struct {
+    menu_state_t state;
+    int current_index;     // Index for state of cursor in lcd that shows oprion like: >play
+    int top_index;         // Index for state of last option like
+    int game_time;         // seconds, 60..300
+    int difficulty;        // We have  0  ,   1     ,  2: See difficulty_labels
+    int64_t message_until; // a message covers the menu until this time, 0 = none
+    bool message_skippable;
+    bomb_t bomb;           // generated when Play is pressed
+    menu_write_line_fn write_line;
+} menu_t;
+
+#define MENU_ITEMS 5
+extern const char *menu_items[MENU_ITEMS];
+extern const char *difficulty_labels[3];
+
+void menu_init(menu_t *m, menu_write_line_fn write_line);
+void menu_render(menu_t *m);
+
+// Draws whatever screen m->state shows, after its fields were set directly
+void menu_redraw(menu_t *m);
+
+// Shows two lines until until_us. A skippable message goes away on the first
+// input, which is then handled by the menu; otherwise input is ignored.
+void menu_show_message(menu_t *m, const char *line0, const char *line1,
+                       int64_t until_us, bool skippable);
+
+// Call with every event, NO_SCROLL included, so messages can time out
+void menu_handle_event(menu_t *m, joystick_event_t event, int64_t now_us);
@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include "recorder.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+static portMUX_TYPE rec_lock = portMUX_INITIALIZER_UNLOCKED;
+#define REC_LOCK()   portENTER_CRITICAL_SAFE(&rec_lock)
+#define REC_UNLOCK() portEXIT_CRITICAL_SAFE(&rec_lock)
+#else
+#define REC_LOCK()
+#define REC_UNLOCK()
+#endif
+
+_Static_assert((REC_BUF_SIZE & (REC_BUF_SIZE - 1)) == 0, "REC_BUF_SIZE must be a power of two");
+#define REC_MASK (REC_BUF_SIZE - 1)
+#define REC_MAX_RECORD 20 // two 10 byte varints
+
+static uint8_t rec_buf[REC_BUF_SIZE];
+static size_t rec_tail = 0;     // oldest record
+static size_t rec_used = 0;
+static int64_t rec_base_us = 0; // time the oldest record's delta counts from
+static int64_t rec_last_us = 0; // time of the newest record
+static uint32_t rec_dropped = 0;
+static bool rec_paused = false;
+static uint16_t rec_checkpoints = 0; // checkpoints in the ring
+static size_t rec_since_checkpoint = 0;
+
+static size_t put_varint(uint8_t *p, uint64_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (uint8_t)v | 0x80;
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+static size_t ring_varint(size_t off, uint64_t *v) {
+    uint64_t x = 0;
+    size_t n = 0;
+    uint8_t b;
+    do {
+        b = rec_buf[(rec_tail + off + n) & REC_MASK];
+        x |= (uint64_t)(b & 0x7F) << (7 * n);
+        n++;
+    } while (b & 0x80);
+    *v = x;
+    return n;
+}
+
+static rec_type_t rec_oldest_type(void) {
+    uint64_t hdr;
+    ring_varint(0, &hdr);
+    return (rec_type_t)(hdr & ((1 << REC_TYPE_BITS) - 1));
+}
+
+static void rec_drop_oldest(void) {
+    uint64_t hdr, value;
+    size_t n = ring_varint(0, &hdr);
+    n += ring_varint(n, &value);
+    if (REC_IS_CHECKPOINT(hdr & ((1 << REC_TYPE_BITS) - 1))) rec_checkpoints--;
+    rec_base_us += (int64_t)(hdr >> REC_TYPE_BITS);
+    rec_tail = (rec_tail + n) & REC_MASK;
+    rec_used -= n;
+    rec_dropped++;
+}
+
+static void rec_write(rec_type_t type, uint64_t value, int64_t now_us) {
+    uint8_t rec[REC_MAX_RECORD];
+
+    REC_LOCK();
+    if (rec_paused) {
+        REC_UNLOCK();
+        return;
+    }
+    // Callers stamp before taking the lock, keep the time monotonic
+    if (now_us < rec_last_us) now_us = rec_last_us;
+    uint64_t delta = (uint64_t)(now_us - rec_last_us);
+
+    size_t n = put_varint(rec, (delta << REC_TYPE_BITS) | type);
+    n += put_varint(rec + n, value);
+
+    if (REC_BUF_SIZE - rec_used < n) {
+        while (REC_BUF_SIZE - rec_used < n) rec_drop_oldest();
+        // Keep the ring starting at a checkpoint, a replay cannot start anywhere else
+        while (rec_checkpoints && !REC_IS_CHECKPOINT(rec_oldest_type())) rec_drop_oldest();
+    }
+    size_t head = (rec_tail + rec_used) & REC_MASK;
+    for (size_t i = 0; i < n; i++) rec_buf[(head + i) & REC_MASK] = rec[i];
+    rec_used += n;
+    rec_last_us = now_us;
+    if (REC_IS_CHECKPOINT(type)) {
+        rec_checkpoints++;
+        rec_since_checkpoint = 0;
+    } else {
+        rec_since_checkpoint += n;
+    }
+    REC_UNLOCK();
+}
+
+void rec_log_at(rec_type_t type, uint32_t value, int64_t now_us) {
+    rec_write(type, value, now_us);
+}
+
+bool rec_checkpoint_due(void) {
+    return rec_since_checkpoint >= REC_CHECKPOINT_BYTES;
+}
+
+void rec_checkpoint_at(rec_type_t type, uint64_t value, int64_t now_us) {
+    rec_write(type, value, now_us);
+}
+
+uint64_t rec_menu_pack(const rec_menu_state_t *s) {
+    return (uint64_t)(s->menu_state & 0xF) | (uint64_t)(s->cursor & 0xF) << 4 |
+           (uint64_t)(s->top & 0xF) << 8 | (uint64_t)(s->difficulty & 0xF) << 12 |
+           (uint64_t)s->game_time << 16;
+}
+
+void rec_menu_unpack(uint64_t v, rec_menu_state_t *s) {
+    s->menu_state = v & 0xF;
+    s->cursor     = (v >> 4) & 0xF;
+    s->top        = (v >> 8) & 0xF;
+    s->difficulty = (v >> 12) & 0xF;
+    s->game_time  = (uint16_t)(v >> 16);
+}
+
+#ifdef ESP_PLATFORM
+void rec_log(rec_type_t type, uint32_t value) {
+    rec_log_at(type, value, esp_timer_get_time());
+}
+#endif
+
+void rec_clear(void) {
+    REC_LOCK();
+    rec_tail = 0;
+    rec_used = 0;
+    rec_base_us = rec_last_us;
+    rec_dropped = 0;
+    rec_checkpoints = 0;
+    rec_since_checkpoint = 0;
+    REC_UNLOCK();
+}
+
+size_t rec_snapshot(uint8_t *out, size_t size, int64_t *base_us, uint32_t *dropped) {
+    REC_LOCK();
+    size_t n = rec_used < size ? rec_used : size;
+    for (size_t i = 0; i < n; i++) out[i] = rec_buf[(rec_tail + i) & REC_MASK];
+    *base_us = rec_base_us;
+    *dropped = rec_dropped;
+    REC_UNLOCK();
+    return n;
+}
+
+void rec_dump(void) {
+    // Printing takes a while, new events are not recorded meanwhile
+    REC_LOCK();
+    rec_paused = true;
+    REC_UNLOCK();
+    printf("REC BEGIN base=%lld len=%u dropped=%lu\n",
+           (long long)rec_base_us, (unsigned)rec_used, (unsigned long)rec_dropped);
+    for (size_t i = 0; i < rec_used; i++) {
+        printf("%02x", rec_buf[(rec_tail + i) & REC_MASK]);
+        if (i % 32 == 31 || i == rec_used - 1) printf("\n");
+    }
+    printf("REC END\n");
+    rec_paused = false;
+}
+
+static bool get_varint(const uint8_t *data, size_t len, size_t *pos, uint64_t *v) {
+    uint64_t x = 0;
+    for (unsigned shift = 0; *pos < len && shift < 64; shift += 7) {
+        uint8_t b = data[(*pos)++];
+        x |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            *v = x;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool rec_decode(const uint8_t *data, size_t len, size_t *pos, int64_t *time_us, rec_event_t *out) {
+    uint64_t hdr, value;
+    if (!get_varint(data, len, pos, &hdr) || !get_varint(data, len, pos, &value)) return false;
+
+    *time_us += (int64_t)(hdr >> REC_TYPE_BITS);
+    out->time_us = *time_us;
+    out->type = (rec_type_t)(hdr & ((1 << REC_TYPE_BITS) - 1));
+    out->value = value;
+    return true;
+}
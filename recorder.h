@@ -0,0 +1,73 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "mem_config.h"
+
+/* ------------------ Recorder ------------------ */
+// Session log for reproducing bug reports. Each record is two LEB128 varints:
+//   (delta_us << REC_TYPE_BITS) | type,  value
+// so a typical event takes 3-4 bytes. The ring keeps the newest REC_BUF_SIZE
+// bytes, the oldest records are dropped whole when it fills up.
+//
+// A replay has to start from a known state, so the owner of that state
+// writes a checkpoint whenever rec_checkpoint_due() says so. Once the ring
+// wraps it drops records up to the oldest checkpoint, and a snapshot then
+// always starts with one (losing at most REC_CHECKPOINT_BYTES of history).
+
+#define REC_TYPE_BITS 3
+#define REC_CHECKPOINT_BYTES (REC_BUF_SIZE / 4)
+
+typedef enum {
+    REC_JOYSTICK   = 0, // value: joystick_event_t
+    REC_BUTTON     = 1, // value: (line << 1) | level
+    REC_TIMER_TICK = 2, // value: seconds left after the tick
+    REC_TIMER_SET  = 3, // value: seconds the countdown starts from
+    REC_MODULE     = 4, // value: (module << 8) | module specific code
+    REC_CHECKPOINT_MENU  = 5, // value: rec_menu_pack()
+    REC_CHECKPOINT_TIMER = 6, // value: seconds left on the countdown
+} rec_type_t;
+
+#define REC_IS_CHECKPOINT(type) ((type) == REC_CHECKPOINT_MENU || (type) == REC_CHECKPOINT_TIMER)
+
+typedef struct {
+    int64_t    time_us;
+    rec_type_t type;
+    uint64_t   value;
+} rec_event_t;
+
+// What a replay needs to pick the menu up in the middle of a session
+typedef struct {
+    uint8_t  menu_state;
+    uint8_t  cursor;
+    uint8_t  top;
+    uint8_t  difficulty;
+    uint16_t game_time;
+} rec_menu_state_t;
+
+uint64_t rec_menu_pack(const rec_menu_state_t *s);
+void rec_menu_unpack(uint64_t v, rec_menu_state_t *s);
+
+void rec_log_at(rec_type_t type, uint32_t value, int64_t now_us);
+#ifdef ESP_PLATFORM
+void rec_log(rec_type_t type, uint32_t value); // stamped with esp_timer_get_time()
+#endif
+void rec_clear(void);
+
+// True once REC_CHECKPOINT_BYTES were logged since the last checkpoint.
+// Each firmware checkpoints only the state it owns (REC_CHECKPOINT_*).
+bool rec_checkpoint_due(void);
+void rec_checkpoint_at(rec_type_t type, uint64_t value, int64_t now_us);
+
+// Copies the ring to out (REC_BUF_SIZE is always enough). *base_us is the time
+// the first record's delta counts from, *dropped how many records the ring
+// has lost so far. Returns the number of bytes copied.
+size_t rec_snapshot(uint8_t *out, size_t size, int64_t *base_us, uint32_t *dropped);
+
+// Prints the ring as hex between "REC BEGIN" and "REC END" lines,
+// host/replay reads this straight from the monitor output
+void rec_dump(void);
+
+// Decodes the record at *pos and advances it. *time_us is the running
+// timestamp (start with base_us). Returns false at the end or on bad data.
+bool rec_decode(const uint8_t *data, size_t len, size_t *pos, int64_t *time_us, rec_event_t *out);
@@ -0,0 +1,104 @@
+#include "replay.h"
+#include "recorder.h"
+
+bool replay_can_start(const uint8_t *data, size_t len, uint32_t dropped) {
+    size_t pos = 0;
+    int64_t time_us = 0;
+    rec_event_t ev;
+    if (!dropped) return true;
+    return rec_decode(data, len, &pos, &time_us, &ev) && REC_IS_CHECKPOINT(ev.type);
+}
+
+bool replay_run(const uint8_t *data, size_t len, int64_t base_us,
+                menu_t *menu, countdown_t *countdown, replay_stats_t *stats) {
+    size_t pos = 0;
+    int64_t time_us = base_us;
+    int64_t timer_start = 0;
+    uint32_t timer_from = 0;
+    bool timer_synced = false;
+    rec_event_t ev;
+
+    *stats = (replay_stats_t){0};
+    while (pos < len) {
+        if (!rec_decode(data, len, &pos, &time_us, &ev)) return false;
+
+        if (!stats->records++) stats->first_us = ev.time_us;
+        stats->last_us = ev.time_us;
+
+        switch (ev.type) {
+        case REC_JOYSTICK:
+            stats->joystick++;
+            menu_handle_event(menu, (joystick_event_t)ev.value, ev.time_us);
+            break;
+
+        case REC_BUTTON:
+            stats->buttons++; // presses already arrive as REC_JOYSTICK
+            break;
+
+        case REC_TIMER_SET:
+            countdownSet(countdown, 0, ev.value);
+            countdownStart(countdown, ev.time_us);
+            timer_start = ev.time_us;
+            timer_from = ev.value;
+            timer_synced = true;
+            break;
+
+        case REC_TIMER_TICK: {
+            stats->ticks++;
+            if (!timer_synced) {
+                // The start fell out of the ring, pick the clock up from here
+                countdownSet(countdown, 0, ev.value);
+                countdownStart(countdown, ev.time_us);
+                timer_start = ev.time_us;
+                timer_from = ev.value;
+                timer_synced = true;
+                break;
+            }
+            countdownUpdate(countdown, ev.time_us);
+            if (countdown->seconds != ev.value) stats->tick_mismatches++;
+
+            // Tick n should land n seconds after the start
+            int64_t ideal = timer_start + (int64_t)(timer_from - ev.value) * 1000000;
+            int64_t drift = ev.time_us - ideal;
+            if (drift > stats->max_tick_drift_us) stats->max_tick_drift_us = drift;
+            break;
+        }
+
+        case REC_MODULE:
+            stats->modules++;
+            break;
+
+        case REC_CHECKPOINT_MENU: {
+            rec_menu_state_t s;
+            stats->checkpoints++;
+            rec_menu_unpack(ev.value, &s);
+            // Live, unrecorded NO_SCROLL events expired any message before this
+            menu_handle_event(menu, NO_SCROLL, ev.time_us);
+            if (stats->records > 1 &&
+                (menu->state != s.menu_state || menu->current_index != s.cursor ||
+                 menu->top_index != s.top || menu->difficulty != s.difficulty ||
+                 menu->game_time != s.game_time))
+                stats->checkpoint_mismatches++;
+            menu->state = (menu_state_t)s.menu_state;
+            menu->current_index = s.cursor;
+            menu->top_index = s.top;
+            menu->difficulty = s.difficulty;
+            menu->game_time = s.game_time;
+            menu->message_until = 0; // checkpoints are never written under a message
+            menu_redraw(menu);
+            break;
+        }
+
+        case REC_CHECKPOINT_TIMER:
+            stats->checkpoints++;
+            if (timer_synced && countdown->seconds == ev.value) break;
+            if (timer_synced) stats->checkpoint_mismatches++;
+
+            // The next tick picks the clock up, as when TIMER_SET fell out
+            countdownSet(countdown, 0, (unsigned int)ev.value);
+            timer_synced = false;
+            break;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "menu.h"
+#include "countdown.h"
+
+/* ------------------ Replay ------------------ */
+// Feeds a recording back into the menu and countdown logic as fast as the
+// CPU allows. Works on the device (rec_snapshot) and on the host (host/replay).
+
+typedef struct {
+    uint32_t records;
+    uint32_t joystick;         // events handed to the menu
+    uint32_t buttons;
+    uint32_t modules;
+    uint32_t ticks;
+    uint32_t checkpoints;
+    uint32_t checkpoint_mismatches; // replayed state disagrees with a later checkpoint
+    uint32_t tick_mismatches;  // countdown disagrees with the recorded seconds
+    int64_t  max_tick_drift_us; // worst tick lateness against an ideal 1 s clock
+    int64_t  first_us, last_us;
+} replay_stats_t;
+
+// A ring that dropped records can only be replayed from a checkpoint,
+// otherwise the menu would start from its defaults in the middle of a session
+bool replay_can_start(const uint8_t *data, size_t len, uint32_t dropped);
+
+// menu and countdown must be initialized by the caller. Returns false if the
+// data ended in the middle of a record.
+bool replay_run(const uint8_t *data, size_t len, int64_t base_us,
+                menu_t *menu, countdown_t *countdown, replay_stats_t *stats);
@@ -0,0 +1,184 @@
+#include "scanner.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "driver/gptimer.h"
+#include "soc/gpio_reg.h"
+#include "dlog.h"
+#include "mem.h"
+
+static const char *TAG = "scanner";
+
+#define SCAN_KP_MAX_PINS 8
+
+typedef struct {
+    uint64_t changed;
+    uint64_t state;
+} scan_change_t;
+
+static scanner_config_t scan_cfg;
+static uint8_t scan_rows[SCAN_KP_MAX_PINS]; // copies in DRAM, the ISR must not touch flash
+static uint8_t scan_cols[SCAN_KP_MAX_PINS];
+static uint32_t scan_rows_mask = 0;  // output bits of all keypad rows
+static uint64_t scan_state = 0;      // debounced levels
+static uint64_t scan_cnt0 = 0;       // vertical counter, bit 0 of every line
+static uint64_t scan_cnt1 = 0;       // ... and bit 1
+static uint64_t scan_matrix = 0;     // last raw level of every keypad cell
+static uint64_t scan_pending = 0;    // changes the queue had no room for
+static uint8_t scan_row = 0;         // row driven low right now
+static QueueHandle_t scan_queue = NULL;
+MEM_QUEUE_STORAGE(SCANNER, scan_change_t);
+MEM_TASK_STORAGE(SCANNER);
+
+static inline uint64_t IRAM_ATTR scan_read_port(void) {
+    return (uint64_t)REG_READ(GPIO_IN_REG) | ((uint64_t)(REG_READ(GPIO_IN1_REG) & 0xFF) << 32);
+}
+
+static inline uint64_t IRAM_ATTR scan_row_mask(uint8_t row) {
+    return ((1ULL << scan_cfg.n_cols) - 1) << SCAN_KP_LINE(row, 0, scan_cfg.n_cols);
+}
+
+static inline void IRAM_ATTR scan_drive_row(uint8_t row) {
+    REG_WRITE(GPIO_OUT_W1TS_REG, scan_rows_mask);
+    REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << scan_rows[row]);
+}
+
+// 2-bit vertical counters: a line has to differ from its debounced state in
+// 4 consecutive samples before it flips. Only lines in fresh take part,
+// the others (keypad rows not scanned this tick) keep their count.
+static inline uint64_t IRAM_ATTR scan_debounce(uint64_t sample, uint64_t fresh) {
+    uint64_t delta = (sample ^ scan_state) & fresh;
+    uint64_t toggle = delta & scan_cnt0 & scan_cnt1;
+
+    scan_cnt1 = (scan_cnt1 & ~fresh) | ((scan_cnt1 ^ scan_cnt0) & delta);
+    scan_cnt0 = (scan_cnt0 & ~fresh) | (~scan_cnt0 & delta);
+    scan_state ^= toggle;
+    return toggle;
+}
+
+static bool IRAM_ATTR scan_tick(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *arg) {
+    uint64_t port = scan_read_port();
+    uint64_t sample = port & scan_cfg.direct_mask;
+    uint64_t fresh = scan_cfg.direct_mask;
+
+    if (scan_cfg.n_rows) {
+        // Columns were given a whole tick to settle since the row went low
+        uint64_t cells = 0;
+        for (uint8_t c = 0; c < scan_cfg.n_cols; c++)
+            cells |= ((port >> scan_cols[c]) & 1ULL) << SCAN_KP_LINE(scan_row, c, scan_cfg.n_cols);
+
+        uint64_t row_mask = scan_row_mask(scan_row);
+        scan_matrix = (scan_matrix & ~row_mask) | cells;
+        sample |= scan_matrix;
+        fresh |= row_mask;
+
+        if (++scan_row == scan_cfg.n_rows) scan_row = 0;
+        scan_drive_row(scan_row);
+    }
+
+    uint64_t changed = scan_debounce(sample, fresh) | scan_pending;
+    if (!changed) return false;
+
+    BaseType_t woken = pdFALSE;
+    scan_change_t ev = { .changed = changed, .state = scan_state };
+    scan_pending = xQueueSendFromISR(scan_queue, &ev, &woken) == pdTRUE ? 0 : changed;
+    return woken == pdTRUE;
+}
+
+static void scanner_task(void *arg) {
+    scan_change_t ev;
+    while (1) {
+        if (xQueueReceive(scan_queue, &ev, portMAX_DELAY) != pdTRUE) continue;
+        for (uint64_t bits = ev.changed; bits; bits &= bits - 1) {
+            uint8_t line = __builtin_ctzll(bits);
+            scan_cfg.on_event(line, (ev.state >> line) & 1, scan_cfg.arg);
+        }
+    }
+}
+
+esp_err_t scanner_start(const scanner_config_t *cfg) {
+    if (scan_queue) return ESP_ERR_INVALID_STATE; // the task and queue are static, start once
+
+    // Check everything before touching any state the ISR reads
+    if (cfg->n_rows > SCAN_KP_MAX_PINS || cfg->n_cols > SCAN_KP_MAX_PINS ||
+        cfg->n_rows * cfg->n_cols > SCAN_KP_MAX_CELLS || (cfg->direct_mask >> SCAN_KP_FIRST_LINE))
+        return ESP_ERR_INVALID_ARG;
+    for (uint8_t c = 0; c < cfg->n_cols; c++) {
+        if (cfg->kp_cols[c] < 0 || cfg->kp_cols[c] >= SCAN_KP_FIRST_LINE) return ESP_ERR_INVALID_ARG;
+    }
+    for (uint8_t r = 0; r < cfg->n_rows; r++) {
+        if (cfg->kp_rows[r] < 0 || cfg->kp_rows[r] >= 32) return ESP_ERR_INVALID_ARG;
+    }
+
+    scan_cfg = *cfg;
+    uint64_t in_mask = cfg->direct_mask;
+    for (uint8_t c = 0; c < cfg->n_cols; c++) {
+        scan_cols[c] = cfg->kp_cols[c];
+        in_mask |= 1ULL << cfg->kp_cols[c];
+    }
+    scan_rows_mask = 0;
+    for (uint8_t r = 0; r < cfg->n_rows; r++) {
+        scan_rows[r] = cfg->kp_rows[r];
+        scan_rows_mask |= 1UL << cfg->kp_rows[r];
+    }
+
+    gpio_config_t in_cfg = {
+        .pin_bit_mask = in_mask,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+    esp_err_t r = gpio_config(&in_cfg);
+    if (r != ESP_OK) return r;
+
+    if (scan_rows_mask) {
+        gpio_config_t row_cfg = {
+            .pin_bit_mask = scan_rows_mask,
+            .mode = GPIO_MODE_OUTPUT_OD,
+            .pull_up_en = GPIO_PULLUP_DISABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_DISABLE,
+        };
+        r = gpio_config(&row_cfg);
+        if (r != ESP_OK) return r;
+        scan_drive_row(0);
+    }
+
+    // Start from what is there now, so boot does not report every line.
+    // Keypad cells start released and settle through the debouncer.
+    scan_matrix = 0;
+    for (uint8_t row = 0; row < cfg->n_rows; row++) scan_matrix |= scan_row_mask(row);
+    scan_state = (scan_read_port() & cfg->direct_mask) | scan_matrix;
+
+    scan_queue = MEM_QUEUE_CREATE(SCANNER, scan_change_t);
+    MEM_TASK_CREATE(SCANNER, scanner_task, NULL);
+
+    gptimer_handle_t timer = NULL;
+    gptimer_config_t timer_cfg = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = 1000000,
+    };
+    r = gptimer_new_timer(&timer_cfg, &timer);
+    if (r != ESP_OK) return r;
+
+    gptimer_event_callbacks_t cbs = { .on_alarm = scan_tick };
+    gptimer_alarm_config_t alarm = {
+        .alarm_count = 1000000 / SCAN_HZ,
+        .reload_count = 0,
+        .flags.auto_reload_on_alarm = true,
+    };
+    gptimer_register_event_callbacks(timer, &cbs, NULL);
+    gptimer_set_alarm_action(timer, &alarm);
+    gptimer_enable(timer);
+    r = gptimer_start(timer);
+
+    DLOG_I(TAG, "scanning %d direct + %d keypad lines at %d Hz",
+           __builtin_popcountll(cfg->direct_mask), cfg->n_rows * cfg->n_cols, SCAN_HZ);
+    return r;
+}
+
+uint64_t scanner_state(void) {
+    return scan_state; // may tear against the ISR, events are the exact source
+}
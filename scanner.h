@@ -0,0 +1,36 @@
+#pragma once
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+/* ------------------ Scanner ------------------ */
+// Reads every input line at once from the GPIO input registers on a 1 kHz
+// timer interrupt, debounces all of them in parallel and reports only the
+// lines that changed.
+//
+// Line numbers: 0..39 are GPIO0..GPIO39 read directly (ESP32 layout),
+// 40..63 are keypad matrix cells, see SCAN_KP_LINE().
+
+#define SCAN_HZ            1000
+#define SCAN_KP_FIRST_LINE 40
+#define SCAN_KP_MAX_CELLS  (64 - SCAN_KP_FIRST_LINE)
+#define SCAN_KP_LINE(row, col, n_cols) (SCAN_KP_FIRST_LINE + (row) * (n_cols) + (col))
+
+// level is the debounced pin level, inputs are pulled up so pressed = 0
+typedef void (*scanner_event_fn)(uint8_t line, uint8_t level, void *arg);
+
+typedef struct {
+    uint64_t direct_mask;     // bit n = GPIOn is a plain input
+    const gpio_num_t *kp_rows; // driven low one at a time, must be below GPIO32
+    uint8_t n_rows;
+    const gpio_num_t *kp_cols; // read while a row is low
+    uint8_t n_cols;
+    scanner_event_fn on_event; // called from the scanner task, not the ISR
+    void *arg;
+} scanner_config_t;
+
+// Call once. An invalid config is rejected before anything is changed.
+esp_err_t scanner_start(const scanner_config_t *cfg);
+
+// Debounced level of every line, bit n = line n
+uint64_t scanner_state(void);
@@ -0,0 +1,58 @@
+#include "text.h"
+
+void text_clear(text_line_t *l) {
+    for (int i = 0; i < TEXT_COLS; i++) l->c[i] = ' ';
+}
+
+uint8_t text_put_char(text_line_t *l, uint8_t col, char ch) {
+    if (col < TEXT_COLS) l->c[col++] = ch;
+    return col;
+}
+
+uint8_t text_put_str(text_line_t *l, uint8_t col, const char *s) {
+    while (*s && col < TEXT_COLS) l->c[col++] = *s++;
+    return col;
+}
+
+uint8_t text_put_uint(text_line_t *l, uint8_t col, uint32_t value, uint8_t width, char pad) {
+    char tmp[10]; // 4294967295
+    uint8_t n = 0;
+    do {
+        tmp[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+
+    while (width > n) {
+        col = text_put_char(l, col, pad);
+        width--;
+    }
+    while (n) col = text_put_char(l, col, tmp[--n]);
+    return col;
+}
+
+uint8_t text_put_mss(text_line_t *l, uint8_t col, uint32_t seconds) {
+    col = text_put_uint(l, col, seconds / 60, 0, '0');
+    col = text_put_char(l, col, ':');
+    return text_put_uint(l, col, seconds % 60, 2, '0');
+}
+
+uint8_t text_put_sscc(text_line_t *l, uint8_t col, uint32_t centis) {
+    col = text_put_uint(l, col, centis / 100, 2, '0');
+    col = text_put_char(l, col, '.');
+    return text_put_uint(l, col, centis % 100, 2, '0');
+}
+
+static void split2(uint32_t v, uint8_t *d) {
+    d[0] = v / 10 % 10;
+    d[1] = v % 10;
+}
+
+void text_digits_mmss(uint32_t seconds, uint8_t digits[4]) {
+    split2(seconds / 60, digits);
+    split2(seconds % 60, digits + 2);
+}
+
+void text_digits_sscc(uint32_t centis, uint8_t digits[4]) {
+    split2(centis / 100, digits);
+    split2(centis % 100, digits + 2);
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ------------------ Text ------------------ */
+// Fixed-width line composition for the 16x2 LCD without snprintf: no
+// varargs, no format parsing, no stack buffers. Every put writes straight
+// into the line, clips at the right edge and returns the next column.
+// The digit splitters feed the 7-segment display in timer.c.
+
+#define TEXT_COLS 16
+
+typedef struct {
+    char c[TEXT_COLS]; // space padded, not NUL terminated
+} text_line_t;
+
+void text_clear(text_line_t *l);
+uint8_t text_put_char(text_line_t *l, uint8_t col, char ch);
+uint8_t text_put_str(text_line_t *l, uint8_t col, const char *s);
+
+// Right aligned in width columns, filled with pad ('0' or ' ').
+// width 0 = as many digits as needed.
+uint8_t text_put_uint(text_line_t *l, uint8_t col, uint32_t value, uint8_t width, char pad);
+
+uint8_t text_put_mss(text_line_t *l, uint8_t col, uint32_t seconds);   // "m:ss"
+uint8_t text_put_sscc(text_line_t *l, uint8_t col, uint32_t centis);   // "SS.cc"
+
+// '>' in column 0 for the selected menu row, ' ' otherwise
+static inline void text_put_cursor(text_line_t *l, bool selected) {
+    l->c[0] = selected ? '>' : ' ';
+}
+
+// 7-segment digits, most significant first: mm:ss and SS.cc
+void text_digits_mmss(uint32_t seconds, uint8_t digits[4]);
+void text_digits_sscc(uint32_t centis, uint8_t digits[4]);
@@ -5,6 +5,11 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "rom/ets_sys.h"
+#include "countdown.h"
+#include "recorder.h"
+#include "dlog.h"
+#include "text.h"
+#include "mem.h"
 
 // ---------------- Pin config ----------------
 #define LATCH_PIN 21  // ST_CP
@@ -13,6 +18,8 @@
 #define LED_PIN   2   // Onboard LED
 #define BUZZER_PIN 4 // Passive buzzer
 
+static const char *TAG = "TIMER";
+
 // ---------------- Maps ----------------
 static const uint8_t digit_map[4] = {
     0b00001110,
@@ -37,9 +44,7 @@ static const uint8_t segment_map[10] = {
 #define DP 0b10000000  // decimal point bit
 
 // ---------------- Timer variables ----------------
-static unsigned int timerSeconds = 5 * 60;
-static int64_t lastUpdate = 0;
-static unsigned int lastMinutes = 0;
+static countdown_t countdown = { .seconds = 5 * 60 }; // logic lives in countdown.c
 
 // ---------------- Utility functions ----------------
 void shiftOut(int dataPin, int clockPin, int bitOrder, uint8_t val) {
@@ -58,8 +63,7 @@ void shiftOut(int dataPin, int clockPin, int bitOrder, uint8_t val) {
 }
 
 void setTimer(unsigned int minutes, unsigned int seconds) {
-    timerSeconds = minutes * 60 + seconds;
-    lastMinutes = timerSeconds / 60;
+    countdownSet(&countdown, minutes, seconds);
 }
 
 // ---------------- Buzzer control ----------------
@@ -86,24 +90,35 @@ void beepBuzzer(int times) {
 
 // ---------------- Timer events ----------------
 void onMinutePassed(void) {
-    printf("Minute passed! Timer = %u seconds\n", timerSeconds);
+    DLOG_I(TAG, "Minute passed! Timer = %u seconds", countdown.seconds);
     beepBuzzer(3); // 3 short pips
 }
 
 void updateTimer() {
     int64_t now = esp_timer_get_time();
-    if ((now - lastUpdate) >= 1000000 && timerSeconds > 0) {
-        timerSeconds--;
-        lastUpdate = now;
-
-        unsigned int currentMinutes = timerSeconds / 60;
-        if (currentMinutes != lastMinutes) {
-            lastMinutes = currentMinutes;
-            onMinutePassed();
-        }
+    int events = countdownUpdate(&countdown, now);
+
+    if (events & COUNTDOWN_TICK) rec_log_at(REC_TIMER_TICK, countdown.seconds, now);
+    if (rec_checkpoint_due()) rec_checkpoint_at(REC_CHECKPOINT_TIMER, countdown.seconds, now);
+    if (events & COUNTDOWN_MINUTE) onMinutePassed();
+}
+
+// 'd' on the console dumps the recording for host/replay,
+// 'm' prints stack high-water marks and heap statistics.
+// Runs below the countdown loop: a dump prints the whole ring, about a
+// second at console speed, and the display must keep multiplexing meanwhile
+void consoleTask(void *arg) {
+    while (1) {
+        int c = getchar();
+        if (c == EOF) clearerr(stdin);
+        else if (c == 'd') rec_dump();
+        else if (c == 'm') mem_report();
+        vTaskDelay(pdMS_TO_TICKS(50));
     }
 }
 
+MEM_TASK_STORAGE(CONSOLE);
+
 // ---------------- Display ----------------
 void showDigit(int pos, int num, bool withDot) {
     gpio_set_level(LATCH_PIN, 0);
@@ -119,22 +134,21 @@ void showDigit(int pos, int num, bool withDot) {
 }
 
 void displayTime() {
-    int minutes = timerSeconds / 60;
-    int seconds = timerSeconds % 60;
-
-    int d1 = minutes / 10;
-    int d2 = minutes % 10;
-    int d3 = seconds / 10;
-    int d4 = seconds % 10;
-
-    showDigit(0, d1, false);
-    showDigit(1, d2, true);
-    showDigit(2, d3, false);
-    showDigit(3, d4, false);
+    uint8_t d[4];
+    text_digits_mmss(countdown.seconds, d); // mm:ss digits, split by text.c
+
+    showDigit(0, d[0], false);
+    showDigit(1, d[1], true);
+    showDigit(2, d[2], false);
+    showDigit(3, d[3], false);
 }
 
 // ---------------- Main task ----------------
 void app_main(void) {
+    // The countdown runs in the main task, report its stack too
+    mem_task_register(MEM_TASK_MAIN, xTaskGetCurrentTaskHandle());
+    dlog_start();
+
     // Setup GPIO for shift register + LED
     gpio_config_t io_conf = {
         .mode = GPIO_MODE_OUTPUT,
@@ -166,8 +180,11 @@ void app_main(void) {
     };
     ledc_channel_config(&buzzer_channel);
 
-    lastUpdate = esp_timer_get_time();
-    lastMinutes = timerSeconds / 60;
+    // One timestamp for both, so the recorded start is the one the countdown uses
+    int64_t now = esp_timer_get_time();
+    countdownStart(&countdown, now);
+    rec_log_at(REC_TIMER_SET, countdown.seconds, now);
+    MEM_TASK_CREATE(CONSOLE, consoleTask, NULL);
 
     while (1) {
         updateTimer();
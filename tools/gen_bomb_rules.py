@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Compiles the defusal manual rules into lookup tables for bomb.c.
+
+    python3 tools/gen_bomb_rules.py > bomb_rules.h
+
+host/Makefile reruns it whenever this script changes.
+"""
+
+RED, BLUE, YELLOW, WHITE, BLACK = range(5)
+WIRE_COLORS = 5
+
+# Simon colors
+S_RED, S_BLUE, S_GREEN, S_YELLOW = range(4)
+
+# Keypad columns from the manual, symbols are numbered 0..26
+KEYPAD_COLUMNS = [
+    [0, 1, 2, 3, 4, 5, 6],
+    [7, 0, 6, 8, 9, 5, 10],
+    [11, 12, 8, 13, 14, 2, 9],
+    [15, 16, 17, 4, 13, 10, 18],
+    [19, 18, 17, 20, 16, 21, 22],
+    [15, 7, 23, 24, 19, 25, 26],
+]
+KEYPAD_SYMBOLS = 27
+
+# [serial has vowel][strikes][flashed color] -> color to press
+SIMON = [
+    [[S_BLUE, S_YELLOW, S_GREEN, S_RED],
+     [S_RED, S_BLUE, S_YELLOW, S_GREEN],
+     [S_YELLOW, S_GREEN, S_BLUE, S_RED]],
+    [[S_BLUE, S_RED, S_YELLOW, S_GREEN],
+     [S_YELLOW, S_GREEN, S_BLUE, S_RED],
+     [S_GREEN, S_RED, S_YELLOW, S_BLUE]],
+]
+
+
+def last_index(wires, color):
+    return max(i for i, c in enumerate(wires) if c == color)
+
+
+def wire_to_cut(wires, odd):
+    n = len(wires)
+    count = [wires.count(c) for c in range(WIRE_COLORS)]
+    last = wires[-1]
+    if n == 3:
+        if count[RED] == 0: return 1
+        if last == WHITE: return n - 1
+        if count[BLUE] > 1: return last_index(wires, BLUE)
+        return n - 1
+    if n == 4:
+        if count[RED] > 1 and odd: return last_index(wires, RED)
+        if last == YELLOW and count[RED] == 0: return 0
+        if count[BLUE] == 1: return 0
+        if count[YELLOW] > 1: return n - 1
+        return 1
+    if n == 5:
+        if last == BLACK and odd: return 3
+        if count[RED] == 1 and count[YELLOW] > 1: return 0
+        if count[BLACK] == 0: return 1
+        return 0
+    if n == 6:
+        if count[YELLOW] == 0 and odd: return 2
+        if count[YELLOW] == 1 and count[WHITE] > 1: return 3
+        if count[RED] == 0: return n - 1
+        return 3
+    raise ValueError(n)
+
+
+def decode(code, n):
+    # wire i is digit i of code in base WIRE_COLORS
+    return [(code // WIRE_COLORS ** i) % WIRE_COLORS for i in range(n)]
+
+
+def c_array(values, per_line=16, fmt="0x{:02x}"):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = []
+    out.append("// Generated by tools/gen_bomb_rules.py, do not edit.")
+    out.append("#pragma once")
+    out.append("#include <stdint.h>")
+    out.append("")
+
+    # Wires: one byte per configuration, low nibble = even serial, high = odd
+    offsets, table = [], []
+    for n in range(3, 7):
+        offsets.append(len(table))
+        for code in range(WIRE_COLORS ** n):
+            w = decode(code, n)
+            table.append(wire_to_cut(w, False) | (wire_to_cut(w, True) << 4))
+    out.append("#define WIRE_RULES_MIN 3")
+    out.append("#define WIRE_RULES_MAX 6")
+    out.append("")
+    out.append("// Offset of the first 3/4/5/6 wire configuration in wire_rules")
+    out.append("static const uint16_t wire_rules_offset[4] = {%s};" % ", ".join(map(str, offsets)))
+    out.append("")
+    out.append("// [offset + colors in base 5, wire 0 least significant] -> wire to cut,")
+    out.append("// low nibble for an even serial number, high nibble for an odd one")
+    out.append("static const uint8_t wire_rules[%d] = {" % len(table))
+    out.append(c_array(table))
+    out.append("};")
+    out.append("")
+
+    # Keypad: position of every symbol in every column, 0xff = not there
+    out.append("#define KEYPAD_COLUMNS %d" % len(KEYPAD_COLUMNS))
+    out.append("#define KEYPAD_COLUMN_LEN %d" % len(KEYPAD_COLUMNS[0]))
+    out.append("#define KEYPAD_SYMBOLS %d" % KEYPAD_SYMBOLS)
+    out.append("")
+    out.append("static const uint8_t keypad_columns[KEYPAD_COLUMNS][KEYPAD_COLUMN_LEN] = {")
+    for col in KEYPAD_COLUMNS:
+        out.append("    {%s}," % ", ".join(map(str, col)))
+    out.append("};")
+    out.append("")
+    out.append("// [column][symbol] -> position in the column, 0xff = not in it")
+    out.append("static const uint8_t keypad_rank[KEYPAD_COLUMNS][KEYPAD_SYMBOLS] = {")
+    for col in KEYPAD_COLUMNS:
+        rank = [col.index(s) if s in col else 0xFF for s in range(KEYPAD_SYMBOLS)]
+        out.append("    {%s}," % ", ".join("0x%02x" % r for r in rank))
+    out.append("};")
+    out.append("")
+
+    out.append("// [serial has vowel][strikes][flashed color] -> color to press")
+    out.append("static const uint8_t simon_rules[2][3][4] = {")
+    for vowel in SIMON:
+        out.append("    {%s}," % ", ".join("{%s}" % ", ".join(map(str, row)) for row in vowel))
+    out.append("};")
+
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()